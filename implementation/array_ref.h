@@ -16,12 +16,19 @@
 #ifndef JNI_BIND_ARRAY_REF_H_
 #define JNI_BIND_ARRAY_REF_H_
 
+#include <cassert>
+#include <cstddef>
+#include <iterator>
 #include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "implementation/array.h"
 #include "implementation/array_view.h"
 #include "implementation/class.h"
 #include "implementation/default_class_loader.h"
+#include "implementation/flattened_array.h"
 #include "implementation/jni_helper/jni_array_helper.h"
 #include "implementation/jni_helper/lifecycle.h"
 #include "implementation/jni_helper/lifecycle_object.h"
@@ -29,10 +36,25 @@
 #include "implementation/local_object.h"
 #include "implementation/object_ref.h"
 #include "implementation/ref_base.h"
+#include "implementation/scoped_elements.h"
+#include "implementation/tracked_array_view.h"
 #include "jni_dep.h"
 
 namespace jni {
 
+// True for contiguous containers of |SpanType| (std::vector, std::array, C
+// arrays, etc.) which can be copied with a single region call.
+template <typename Container, typename SpanType, typename Enable = void>
+static constexpr bool kIsContiguousContainerOf = false;
+
+template <typename Container, typename SpanType>
+static constexpr bool kIsContiguousContainerOf<
+    Container, SpanType,
+    std::void_t<decltype(std::data(std::declval<const Container&>())),
+                decltype(std::size(std::declval<const Container&>()))>> =
+    std::is_convertible_v<decltype(std::data(std::declval<const Container&>())),
+                          const SpanType*>;
+
 // Note: All arrays are local (global arrays of local objects is too confusing).
 template <typename JniT>
 using ScopedArrayImpl =
@@ -52,10 +74,78 @@ class ArrayRef : public ScopedArrayImpl<JniT> {
 
   explicit ArrayRef(int size) : ArrayRef(static_cast<std::size_t>(size)) {}
 
+  // Allocates and fills an array from a contiguous container of |SpanType| in
+  // a single New<Type>Array and Set<Type>ArrayRegion.
+  template <typename Container,
+            typename = std::enable_if_t<
+                kIsContiguousContainerOf<Container, SpanType>>>
+  explicit ArrayRef(const Container& container)
+      : ArrayRef(NewFilledArray(std::data(container), std::size(container))) {}
+
+  // Allocates and fills an array from an iterator range.  Ranges that aren't
+  // pointers to |SpanType| are staged in a temporary buffer first.
+  template <typename It, typename = typename std::iterator_traits<
+                             It>::iterator_category>
+  ArrayRef(It first, It last) : ArrayRef(NewFilledArray(first, last)) {}
+
   ArrayView<SpanType, JniT::kRank> Pin(bool copy_on_completion = true) {
     return {Base::object_ref_, copy_on_completion, Length()};
   }
 
+  // Pins with an explicit |PinMode|, e.g. |PinMode::kReadOnly| for inputs
+  // that are never written to.
+  ArrayView<SpanType, JniT::kRank> Pin(PinMode mode) {
+    return {Base::object_ref_, mode, Length()};
+  }
+
+  // Pins with |GetPrimitiveArrayCritical|, see |CriticalArrayView|.
+  //
+  // No JNI calls (including through other jni-bind objects) may be made while
+  // the returned view is alive.
+  CriticalArrayView<SpanType> PinCritical(bool copy_on_completion = true) {
+    return {Base::object_ref_, copy_on_completion, Length()};
+  }
+
+  CriticalArrayView<SpanType> PinCritical(PinMode mode) {
+    return {Base::object_ref_, mode, Length()};
+  }
+
+  // Pins and only writes back chunks modified through the view, see
+  // |TrackedArrayView|.
+  TrackedArrayView<SpanType> PinTracked(
+      std::size_t chunk_size = TrackedArrayView<SpanType>::kDefaultChunkSize) {
+    return {Base::object_ref_, Length(), chunk_size};
+  }
+
+  // Copies |len| elements starting at |offset| into |out| without pinning.
+  //
+  // Prefer this over |Pin()| for reads of a small part of a large array, or
+  // when the data is only read once.
+  void GetRegion(std::size_t offset, std::size_t len, SpanType* out) {
+    assert(len <= Length() && offset <= Length() - len);
+    JniArrayHelper<SpanType, JniT::kRank>::GetArrayRegion(Base::object_ref_,
+                                                          offset, len, out);
+  }
+
+  // Copies |len| elements from |in| into the array starting at |offset|.
+  void SetRegion(std::size_t offset, std::size_t len, const SpanType* in) {
+    assert(len <= Length() && offset <= Length() - len);
+    JniArrayHelper<SpanType, JniT::kRank>::SetArrayRegion(Base::object_ref_,
+                                                          offset, len, in);
+  }
+
+  // Fills a contiguous container (e.g. std::vector, std::array) from |offset|.
+  template <typename Container>
+  void GetRegion(std::size_t offset, Container& out) {
+    GetRegion(offset, std::size(out), std::data(out));
+  }
+
+  // Writes a contiguous container (e.g. std::vector, std::array) at |offset|.
+  template <typename Container>
+  void SetRegion(std::size_t offset, const Container& in) {
+    SetRegion(offset, std::size(in), std::data(in));
+  }
+
   std::size_t Length() {
     if (length_.load() == kNoIdx) {
       length_.store(
@@ -65,7 +155,60 @@ class ArrayRef : public ScopedArrayImpl<JniT> {
     return length_.load();
   }
 
+  // Copies the whole array into a new vector with a single region call.
+  std::vector<SpanType> ToVector() {
+    std::vector<SpanType> ret(Length());
+    GetRegion(0, ret.size(), ret.data());
+    return ret;
+  }
+
+  // Copies the whole array into |out|, which must hold at least |Length()|
+  // elements.
+  void CopyTo(SpanType* out, std::size_t out_size) {
+    assert(out_size >= Length());
+    GetRegion(0, Length(), out);
+  }
+
+  template <typename Container>
+  void CopyTo(Container& out) {
+    CopyTo(std::data(out), std::size(out));
+  }
+
  private:
+  struct FilledArray {
+    typename JniArrayHelper<SpanType, JniT::kRank>::AsArrayType array;
+    std::size_t size;
+  };
+
+  explicit ArrayRef(FilledArray filled_array) : Base(filled_array.array) {
+    length_.store(filled_array.size);
+  }
+
+  // Yields an empty (null) array if allocation fails, in which case an
+  // OutOfMemoryError is pending.
+  static FilledArray NewFilledArray(const SpanType* data, std::size_t size) {
+    FilledArray ret{JniArrayHelper<SpanType, JniT::kRank>::NewArray(size),
+                    size};
+    if (ret.array == nullptr) {
+      ret.size = 0;
+      return ret;
+    }
+
+    JniArrayHelper<SpanType, JniT::kRank>::SetArrayRegion(ret.array, 0, size,
+                                                          data);
+    return ret;
+  }
+
+  template <typename It>
+  static FilledArray NewFilledArray(It first, It last) {
+    if constexpr (std::is_convertible_v<It, const SpanType*>) {
+      return NewFilledArray(first, static_cast<std::size_t>(last - first));
+    } else {
+      const std::vector<SpanType> staged(first, last);
+      return NewFilledArray(staged.data(), staged.size());
+    }
+  }
+
   std::atomic<std::size_t> length_ = kNoIdx;
 };
 
@@ -140,6 +283,13 @@ class ArrayRef<
     return {JniArrayHelper<jobject, JniT::kRank>::GetArrayElement(
         Base::object_ref_, idx)};
   }
+
+  // Iterates elements as |LocalObject|s, see |ScopedElements|.
+  ScopedElements<
+      LocalObject<JniT::class_v, JniT::class_loader_v, JniT::jvm_v>, 1>
+  Elements(std::size_t capacity_chunk = 0) {
+    return {Base::object_ref_, Base::Length(), capacity_chunk};
+  }
 };
 
 // |SpanType| is object or rank is > 1.
@@ -149,6 +299,17 @@ class ArrayRef<JniT, std::enable_if_t<(JniT::kRank > 1)>>
  public:
   using Base = ArrayRefBase<JniT>;
   using Base::Base;
+  using SpanType = typename JniT::SpanType;
+
+  static constexpr bool kIsPrimitive = !std::is_same_v<SpanType, jobject> &&
+                                       !std::is_same_v<SpanType, jstring>;
+
+  // Builds a primitive array (allocating every row in one pass) from a row
+  // major buffer and its shape, see |FlattenedArray|.
+  explicit ArrayRef(const FlattenedArray<SpanType>& flattened)
+      : ArrayRef(CheckRank(flattened), 0, flattened.Size()) {
+    static_assert(kIsPrimitive, "Only primitive arrays can be flattened.");
+  }
 
   static constexpr std::decay_t<decltype(JniT::GetClass())> clazz =
       JniT::GetClass();
@@ -163,6 +324,14 @@ class ArrayRef<JniT, std::enable_if_t<(JniT::kRank > 1)>>
             Base::object_ref_, idx))};
   }
 
+  // Iterates elements as |LocalArray|s, see |ScopedElements|.
+  ScopedElements<LocalArray<typename JniT::SpanType, JniT::kRank - 1, clazz,
+                            class_loader, jvm>,
+                 JniT::kRank>
+  Elements(std::size_t capacity_chunk = 0) {
+    return {Base::object_ref_, Base::Length(), capacity_chunk};
+  }
+
   template <typename SpanType, std::size_t kRank_, const auto& class_v_,
             const auto& class_loader_v_, const auto& jvm_v_>
   void Set(std::size_t idx, const LocalArray<SpanType, kRank_, class_v_,
@@ -172,6 +341,90 @@ class ArrayRef<JniT, std::enable_if_t<(JniT::kRank > 1)>>
     JniArrayHelper<ElementT, JniT::kRank>::SetArrayElement(
         Base::object_ref_, idx, static_cast<ElementT>(val));
   }
+
+  // Copies a primitive array into a row major buffer with one region copy per
+  // row, holding a single row local at a time.  Null rows are read as empty.
+  FlattenedArray<SpanType> Flatten() {
+    static_assert(kIsPrimitive, "Only primitive arrays can be flattened.");
+
+    FlattenedArray<SpanType> ret;
+    ret.offsets.resize(JniT::kRank - 1, std::vector<std::size_t>{0});
+    FlattenInto(ret);
+
+    return ret;
+  }
+
+ private:
+  template <typename, typename>
+  friend class ArrayRef;
+
+  // The private constructor indexes |offsets| by depth, which is only valid if
+  // |flattened| has this array's rank.
+  static const FlattenedArray<SpanType>& CheckRank(
+      const FlattenedArray<SpanType>& flattened) {
+    assert(flattened.Rank() == JniT::kRank);
+    return flattened;
+  }
+
+  // Builds the elements [first, last) of the flattened level for this rank.
+  ArrayRef(const FlattenedArray<SpanType>& flattened, std::size_t first,
+           std::size_t last)
+      : Base(last - first) {
+    const std::vector<std::size_t>& level =
+        flattened.offsets[flattened.Rank() - JniT::kRank];
+
+    for (std::size_t i = first; i < last; ++i) {
+      if constexpr (JniT::kRank == 2) {
+        LocalArray<SpanType, 1, kNoClassSpecified, kDefaultClassLoader,
+                   kDefaultJvm>
+            row{flattened.data.data() + level[i],
+                flattened.data.data() + level[i + 1]};
+        Set(i - first, row);
+        DeleteRowNow(row);
+      } else {
+        LocalArray<SpanType, JniT::kRank - 1, kNoClassSpecified,
+                   kDefaultClassLoader, kDefaultJvm>
+            sub_array{flattened, level[i], level[i + 1]};
+        Set(i - first, sub_array);
+        DeleteRowNow(sub_array);
+      }
+    }
+  }
+
+  // Rows are deleted directly (see |LifecycleLocalBase::DeleteImmediately|),
+  // so flattening holds one local per rank under |FrameOwnedLocals| too.
+  template <typename RowT>
+  static void DeleteRowNow(RowT& row) {
+    LifecycleHelper<jobject, LifecycleType::LOCAL>::DeleteImmediately(
+        static_cast<jobject>(row.Release()));
+  }
+
+  template <typename FlattenedT>
+  void FlattenInto(FlattenedT& flattened) {
+    const std::size_t depth = flattened.Rank() - JniT::kRank;
+    const std::size_t size = Base::Length();
+
+    for (std::size_t i = 0; i < size; ++i) {
+      auto element = Get(i);
+
+      if (static_cast<jobject>(element) != nullptr) {
+        if constexpr (JniT::kRank == 2) {
+          const std::size_t len = element.Length();
+          const std::size_t start = flattened.data.size();
+          flattened.data.resize(start + len);
+          element.GetRegion(0, len, flattened.data.data() + start);
+        } else {
+          element.FlattenInto(flattened);
+        }
+      }
+      DeleteRowNow(element);
+
+      flattened.offsets[depth].push_back(
+          depth + 1 == flattened.offsets.size()
+              ? flattened.data.size()
+              : flattened.offsets[depth + 1].size() - 1);
+    }
+  }
 };
 
 }  // namespace jni
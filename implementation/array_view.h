@@ -16,7 +16,9 @@
 #ifndef JNI_BIND_IMPLEMENTATION_ARRAY_VIEW_H_
 #define JNI_BIND_IMPLEMENTATION_ARRAY_VIEW_H_
 
+#include <cstddef>
 #include <iterator>
+#include <type_traits>
 
 #include "implementation/array_type_conversion.h"
 #include "implementation/jni_helper/jni_array_helper.h"
@@ -24,6 +26,20 @@
 
 namespace jni {
 
+// Controls how changes made through a pinned primitive array are propagated
+// back to Java when the view is released.
+enum class PinMode {
+  // Changes are discarded (JNI_ABORT).
+  kReadOnly,
+  // Changes are copied back (mode 0).
+  kWriteBack,
+};
+
+// Returns the JNI release mode for |mode|.
+constexpr jint ToReleaseMode(PinMode mode) {
+  return mode == PinMode::kWriteBack ? 0 : JNI_ABORT;
+}
+
 // Primitive Rank 1 Arrays.
 template <typename SpanType, std::size_t kRank = 1, typename Enable = void>
 class ArrayView {
@@ -75,15 +91,20 @@ class ArrayView {
   ArrayView(const ArrayView&) = delete;
 
   ArrayView(jarray array, bool copy_on_completion, std::size_t size)
+      : ArrayView(array,
+                  copy_on_completion ? PinMode::kWriteBack : PinMode::kReadOnly,
+                  size) {}
+
+  ArrayView(jarray array, PinMode mode, std::size_t size)
       : array_(array),
         get_array_elements_result_(
             JniArrayHelper<SpanType, kRank>::GetArrayElements(array)),
-        copy_on_completion_(copy_on_completion),
+        mode_(mode),
         size_(size) {}
 
   ~ArrayView() {
     JniArrayHelper<SpanType, kRank>::ReleaseArrayElements(
-        array_, get_array_elements_result_.ptr_, copy_on_completion_);
+        array_, get_array_elements_result_.ptr_, ToReleaseMode(mode_));
   }
 
   // Arrays of rank > 1 are object arrays which are not contiguous.
@@ -91,17 +112,90 @@ class ArrayView {
     return get_array_elements_result_.ptr_;
   }
 
+  // True if the VM handed back a copy instead of the Java array's memory.
+  bool IsCopy() const {
+    return get_array_elements_result_.is_copy == JNI_TRUE;
+  }
+
+  // Copies changes back to Java without unpinning (JNI_COMMIT), e.g. for a
+  // long lived buffer that Java polls.  Writes to a direct (non-copy) pointer
+  // are already visible to Java, so this is a no-op for them.  Changes to a
+  // |PinMode::kReadOnly| view are never copied back, so it's a no-op there too.
+  void Commit() {
+    if (mode_ == PinMode::kReadOnly || !IsCopy()) {
+      return;
+    }
+
+    JniArrayHelper<SpanType, kRank>::ReleaseArrayElements(
+        array_, get_array_elements_result_.ptr_, JNI_COMMIT);
+  }
+
   Iterator begin() { return Iterator{ptr(), size_, 0}; }
   Iterator end() { return Iterator{ptr(), size_, size_}; }
 
  protected:
   const jarray array_;
   const GetArrayElementsResult<SpanType> get_array_elements_result_;
-  const bool copy_on_completion_;
+  const PinMode mode_;
+  const std::size_t size_;
+};
+
+// Primitive Rank 1 Arrays pinned with |GetPrimitiveArrayCritical|.
+//
+// The VM is far more likely to hand back a direct pointer to the Java heap
+// than with |ArrayView|, but while the view is alive the thread must not make
+// any other JNI calls or block on another Java thread (GC may be disabled).
+// Keep its scope to short, tight loops over the data.
+template <typename SpanType>
+class CriticalArrayView {
+ public:
+  static_assert(!std::is_same_v<SpanType, jobject> &&
+                    !std::is_same_v<SpanType, jstring>,
+                "Only primitive arrays can be pinned critically.");
+
+  using Iterator = typename ArrayView<SpanType, 1>::Iterator;
+
+  CriticalArrayView(CriticalArrayView&&) = delete;
+  CriticalArrayView(const CriticalArrayView&) = delete;
+
+  CriticalArrayView(jarray array, bool copy_on_completion, std::size_t size)
+      : CriticalArrayView(
+            array,
+            copy_on_completion ? PinMode::kWriteBack : PinMode::kReadOnly,
+            size) {}
+
+  CriticalArrayView(jarray array, PinMode mode, std::size_t size)
+      : array_(array),
+        get_array_elements_result_(
+            JniArrayHelperBase::GetPrimitiveArrayCritical(array)),
+        mode_(mode),
+        size_(size) {}
+
+  ~CriticalArrayView() {
+    JniArrayHelperBase::ReleasePrimitiveArrayCritical(
+        array_, get_array_elements_result_.ptr_, ToReleaseMode(mode_));
+  }
+
+  SpanType* ptr() {
+    return static_cast<SpanType*>(get_array_elements_result_.ptr_);
+  }
+
+  Iterator begin() { return Iterator{ptr(), size_, 0}; }
+  Iterator end() { return Iterator{ptr(), size_, size_}; }
+
+ protected:
+  const jarray array_;
+  const GetArrayElementsResult<void> get_array_elements_result_;
+  const PinMode mode_;
   const std::size_t size_;
 };
 
 // Object arrays, or arrays with rank > 1 (which are object arrays), or strings.
+//
+// Each dereference returns a raw local reference which is never deleted, so
+// iterating an array leaks one local per element into the current frame.  For
+// anything beyond a handful of elements prefer |Elements()|, which yields
+// scoped locals and releases each one as it advances.
 template <typename SpanType, std::size_t kRank>
 class ArrayView<
     SpanType, kRank,
@@ -145,6 +239,7 @@ class ArrayView<
       return tmp;
     }
 
+    // Returns a new local reference owned by the caller (see above).
     PinHelper_t operator*() const {
       if constexpr (kRank >= 2) {
         return static_cast<PinHelper_t>(
@@ -192,6 +287,10 @@ class ArrayView<
 template <typename SpanType, std::size_t kRank>
 ArrayView(ArrayView<SpanType, kRank>&&) -> ArrayView<SpanType, kRank>;
 
+template <typename SpanType>
+CriticalArrayView(CriticalArrayView<SpanType>&&)
+    -> CriticalArrayView<SpanType>;
+
 }  // namespace jni
 
 #endif  // JNI_BIND_IMPLEMENTATION_ARRAY_VIEW_H_
@@ -26,15 +26,20 @@ namespace {
 using ::jni::ArrayView;
 using ::jni::CDecl_t;
 using ::jni::Class;
+using ::jni::CriticalArrayView;
 using ::jni::LocalArray;
 using ::jni::LocalObject;
 using ::jni::Method;
 using ::jni::Params;
+using ::jni::PinMode;
 using ::jni::Return;
 using ::jni::test::Fake;
 using ::jni::test::JniTest;
 using ::testing::_;
+using ::testing::DoAll;
 using ::testing::Eq;
+using ::testing::InSequence;
+using ::testing::SetArgPointee;
 
 ////////////////////////////////////////////////////////////////////////////////
 // Pin Tests.
@@ -287,6 +292,111 @@ TEST_F(JniTest, ArrayView_DoubleIsIterable) {
                          fake_vals.end()));
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Pin Mode Tests.
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(JniTest, ArrayView_ReadOnlyModeDiscardsChanges) {
+  EXPECT_CALL(*env_, GetIntArrayElements)
+      .WillOnce(::testing::Return(Fake<jint*>()));
+  EXPECT_CALL(*env_, ReleaseIntArrayElements(Fake<jintArray>(), Fake<jint*>(),
+                                             JNI_ABORT));
+
+  LocalArray<jint> int_arr{Fake<jintArray>()};
+  ArrayView view = int_arr.Pin(PinMode::kReadOnly);
+}
+
+TEST_F(JniTest, ArrayView_WriteBackModeCopiesChanges) {
+  EXPECT_CALL(*env_, GetIntArrayElements)
+      .WillOnce(::testing::Return(Fake<jint*>()));
+  EXPECT_CALL(*env_,
+              ReleaseIntArrayElements(Fake<jintArray>(), Fake<jint*>(), 0));
+
+  LocalArray<jint> int_arr{Fake<jintArray>()};
+  ArrayView view = int_arr.Pin(PinMode::kWriteBack);
+}
+
+TEST_F(JniTest, ArrayView_CommitFlushesCopiesWithoutUnpinning) {
+  EXPECT_CALL(*env_, GetLongArrayElements(Fake<jlongArray>(), _))
+      .WillOnce(DoAll(SetArgPointee<1>(JNI_TRUE),
+                      ::testing::Return(Fake<jlong*>())));
+
+  InSequence seq;
+  EXPECT_CALL(*env_, ReleaseLongArrayElements(Fake<jlongArray>(),
+                                              Fake<jlong*>(), JNI_COMMIT))
+      .Times(2);
+  EXPECT_CALL(*env_,
+              ReleaseLongArrayElements(Fake<jlongArray>(), Fake<jlong*>(), 0));
+
+  LocalArray<jlong> long_arr{Fake<jlongArray>()};
+  ArrayView view = long_arr.Pin(PinMode::kWriteBack);
+  EXPECT_TRUE(view.IsCopy());
+  view.Commit();
+  view.Commit();
+}
+
+TEST_F(JniTest, ArrayView_CommitIsSkippedForReadOnlyViews) {
+  EXPECT_CALL(*env_, GetLongArrayElements(Fake<jlongArray>(), _))
+      .WillOnce(DoAll(SetArgPointee<1>(JNI_TRUE),
+                      ::testing::Return(Fake<jlong*>())));
+  EXPECT_CALL(*env_, ReleaseLongArrayElements(_, _, JNI_COMMIT)).Times(0);
+  EXPECT_CALL(*env_, ReleaseLongArrayElements(Fake<jlongArray>(),
+                                              Fake<jlong*>(), JNI_ABORT));
+
+  LocalArray<jlong> long_arr{Fake<jlongArray>()};
+  ArrayView view = long_arr.Pin(PinMode::kReadOnly);
+  EXPECT_TRUE(view.IsCopy());
+  view.Commit();
+}
+
+TEST_F(JniTest, ArrayView_CommitIsSkippedForDirectPointers) {
+  EXPECT_CALL(*env_, GetLongArrayElements(Fake<jlongArray>(), _))
+      .WillOnce(DoAll(SetArgPointee<1>(JNI_FALSE),
+                      ::testing::Return(Fake<jlong*>())));
+  EXPECT_CALL(*env_, ReleaseLongArrayElements(_, _, JNI_COMMIT)).Times(0);
+  EXPECT_CALL(*env_,
+              ReleaseLongArrayElements(Fake<jlongArray>(), Fake<jlong*>(), 0));
+
+  LocalArray<jlong> long_arr{Fake<jlongArray>()};
+  ArrayView view = long_arr.Pin();
+  EXPECT_FALSE(view.IsCopy());
+  view.Commit();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Critical Pin Tests.
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(JniTest, CriticalArrayView_GetsAndReleasesCritically) {
+  std::array fake_vals{jfloat{1.f}, jfloat{2.f}, jfloat{3.f}};
+
+  EXPECT_CALL(*env_, GetArrayLength(Fake<jfloatArray>()))
+      .WillOnce(::testing::Return(3));
+  EXPECT_CALL(*env_, GetFloatArrayElements).Times(0);
+  EXPECT_CALL(*env_, GetPrimitiveArrayCritical(Fake<jfloatArray>(), _))
+      .WillOnce(::testing::Return(fake_vals.data()));
+  EXPECT_CALL(*env_, ReleasePrimitiveArrayCritical(Fake<jfloatArray>(),
+                                                   fake_vals.data(), 0));
+
+  LocalArray<jfloat> float_arr{Fake<jfloatArray>()};
+  CriticalArrayView<jfloat> view = float_arr.PinCritical();
+
+  EXPECT_EQ(view.ptr(), fake_vals.data());
+  EXPECT_TRUE(std::equal(view.begin(), view.end(), fake_vals.begin(),
+                         fake_vals.end()));
+}
+
+TEST_F(JniTest, CriticalArrayView_AbortsWithoutCopyOnCompletion) {
+  std::array fake_vals{jdouble{1.}, jdouble{2.}};
+
+  EXPECT_CALL(*env_, GetPrimitiveArrayCritical)
+      .WillOnce(::testing::Return(fake_vals.data()));
+  EXPECT_CALL(*env_, ReleasePrimitiveArrayCritical(Fake<jdoubleArray>(),
+                                                   fake_vals.data(),
+                                                   JNI_ABORT));
+
+  LocalArray<jdouble> double_arr{Fake<jdoubleArray>()};
+  CriticalArrayView view = double_arr.PinCritical(false);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Iteration Tests: Objects.
 ////////////////////////////////////////////////////////////////////////////////
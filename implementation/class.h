@@ -25,6 +25,8 @@
 #include "constructor.h"
 #include "field.h"
 #include "object.h"
+#include "implementation/final.h"
+#include "implementation/jvalue_args.h"
 #include "implementation/method.h"
 #include "implementation/no_idx.h"
 #include "implementation/static.h"
@@ -61,6 +63,12 @@ struct Class<std::tuple<Constructors_...>,
   const std::tuple<Methods_...> methods_;
   const std::tuple<Fields_...> fields_;
 
+  // See |Final|.
+  const bool is_final_ = false;
+
+  // See |JValueArgs|.
+  const bool jvalue_args_ = false;
+
   // Ctors + static.
   explicit constexpr Class(
       const char* class_name, Constructors_... constructors,
@@ -100,6 +108,36 @@ struct Class<std::tuple<Constructors_...>,
                            Fields_... fields)
       : Class(class_name, Constructor<>{}, Static{}, methods..., fields...) {}
 
+  // Any of the above, but final (e.g. Class{"kClass", Final{}, Method{...}}).
+  template <typename... Params>
+  explicit constexpr Class(const char* class_name, Final, Params... params)
+      : Class(Final{}, Class(class_name, params...)) {}
+
+  constexpr Class(Final, const Class& rhs)
+      : Object(rhs.name_),
+        constructors_(rhs.constructors_),
+        static_(rhs.static_),
+        methods_(rhs.methods_),
+        fields_(rhs.fields_),
+        is_final_(true),
+        jvalue_args_(rhs.jvalue_args_) {}
+
+  // Any of the above, invoked with jvalue arrays (e.g.
+  // Class{"kClass", JValueArgs{}, Method{...}}).
+  template <typename... Params>
+  explicit constexpr Class(const char* class_name, JValueArgs,
+                           Params... params)
+      : Class(JValueArgs{}, Class(class_name, params...)) {}
+
+  constexpr Class(JValueArgs, const Class& rhs)
+      : Object(rhs.name_),
+        constructors_(rhs.constructors_),
+        static_(rhs.static_),
+        methods_(rhs.methods_),
+        fields_(rhs.fields_),
+        is_final_(rhs.is_final_),
+        jvalue_args_(true) {}
+
   template <typename... Params, typename... Constructors,
             typename... StaticMethods, typename... StaticFields,
             typename... Fields, typename... Methods>
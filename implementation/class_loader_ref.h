@@ -21,6 +21,7 @@
 #include "class_defs/java_lang_classes.h"
 #include "implementation/class.h"
 #include "implementation/class_loader.h"
+#include "implementation/class_ref.h"
 #include "implementation/global_object.h"
 #include "implementation/id.h"
 #include "implementation/jni_helper/jni_env.h"
@@ -33,6 +34,7 @@
 #include "implementation/method_ref.h"
 #include "implementation/object_ref.h"
 #include "implementation/params.h"
+#include "implementation/prewarm.h"
 #include "implementation/return.h"
 #include "jni_dep.h"
 #include "metaprogramming/contains.h"
@@ -61,6 +63,36 @@ class ClassLoaderRef : public ClassLoaderImpl<lifecycleType> {
     }
   }
 
+  // Type used by objects of |class_v| built from this loader.
+  template <const auto& class_v>
+  using JniForClassT =
+      JniT<jobject, class_v, ParentLoaderForClass<class_loader_v_, class_v>(),
+           JvmForLoader<class_v>()>;
+
+  // Loads |class_v| through this loader instance (if it isn't already loaded)
+  // and returns it.  Only for classes not deferred to the default loader.
+  template <const auto& class_v>
+  jclass PrimeClass() {
+    return ClassRef_t<JniForClassT<class_v>>::PrimeJClassFromClassLoader(
+        static_cast<jobject>(*this));
+  }
+
+  template <const auto& class_v>
+  void PrewarmClass() {
+    static_assert(
+        !(ParentLoaderForClass<class_loader_v_, class_v>() == kNullClassLoader),
+        "Cannot prewarm this class with this loader.");
+
+    if constexpr (ParentLoaderForClass<class_loader_v_, class_v>() !=
+                  kDefaultClassLoader) {
+      if (jclass clazz = PrimeClass<class_v>()) {
+        Prewarmer<JniForClassT<class_v>>::PrewarmIds(clazz);
+      }
+    } else {
+      Prewarmer<JniForClassT<class_v>>::PrewarmClassAndIds();
+    }
+  }
+
  public:
   using Base = ClassLoaderImpl<lifecycleType>;
   using Base::Base;
@@ -71,32 +103,31 @@ class ClassLoaderRef : public ClassLoaderImpl<lifecycleType> {
 
   template <const auto& class_v, typename... Params>
   [[nodiscard]] auto BuildLocalObject(Params&&... params) {
-    using JniClassT = JniT<jobject, class_v>;
-    using IdClassT = Id<JniClassT, IdType::CLASS>;
     static_assert(
         !(ParentLoaderForClass<class_loader_v_, class_v>() == kNullClassLoader),
         "Cannot build this class with this loader.");
 
+    using LocalObjectT =
+        LocalObject<class_v, ParentLoaderForClass<class_loader_v_, class_v>(),
+                    JvmForLoader<class_v>()>;
+
     if constexpr (ParentLoaderForClass<class_loader_v_, class_v>() !=
                   kDefaultClassLoader) {
-      ClassRef_t<JniT<jobject, class_v, class_loader_v_, jvm_v_,
-                      0>>::PrimeJClassFromClassLoader([=]() {
-        // Prevent the object (which is a runtime instance of a class) from
-        // falling out of scope so it is not released.
-        LocalObject loaded_class =
-            (*this)("loadClass", IdClassT::kNameUsingDots);
-
-        // We only want to create global references if we are actually going
-        // to use them so that they do not leak.
-        jclass test_class{
-            static_cast<jclass>(static_cast<jobject>(loaded_class))};
-        return static_cast<jclass>(JniEnv::GetEnv()->NewGlobalRef(test_class));
-      });
+      // Builds with this instance's class, not another instance's.
+      typename ClassRef_t<JniForClassT<class_v>>::BuildScope build_scope{
+          PrimeClass<class_v>()};
+      return LocalObjectT{std::forward<Params>(params)...};
+    } else {
+      return LocalObjectT{std::forward<Params>(params)...};
     }
-    return LocalObject<class_v,
-                       ParentLoaderForClass<class_loader_v_, class_v>(),
-                       JvmForLoader<class_v>()>{
-        std::forward<Params>(params)...};
+  }
+
+  // Eagerly loads |class_vs| through this loader and resolves all of their
+  // jmethodIDs and jfieldIDs so that first calls don't pay for the lookups.
+  // Classes this loader defers to the default loader are found with FindClass.
+  template <const auto&... class_vs>
+  void Prewarm() {
+    (PrewarmClass<class_vs>(), ...);
   }
 
   template <const auto& class_v, typename... Params>
@@ -41,6 +41,7 @@ using ::jni::PromoteToGlobal;
 using ::jni::Return;
 using ::jni::SupportedClassSet;
 using ::jni::test::AsGlobal;
+using ::jni::test::AsWeak;
 using ::jni::test::Fake;
 using ::jni::test::JniTest;
 using ::jni::test::JniTestWithNoDefaultJvmRef;
@@ -321,6 +322,253 @@ TEST_F(JniTestWithNoDefaultJvmRef,
   TearDown();
 }
 
+TEST_F(JniTestWithNoDefaultJvmRef,
+       ClassLoaderRefTest_IdsAreNotReusedAcrossLoaderInstances) {
+  static constexpr Class kClass{"com/google/kClass",
+                                Method{"Foo", Return{}, Params{}}};
+  static constexpr ClassLoader kClassLoader{kNullClassLoader,
+                                            SupportedClassSet{kClass}};
+  static constexpr Jvm kJvm{kClassLoader};
+
+  EXPECT_CALL(*env_, GetMethodID).Times(testing::AnyNumber());
+
+  // Each loader instance loads its own jclass.
+  EXPECT_CALL(*env_, CallObjectMethodV(Fake<jobject>(1), _, _))
+      .WillOnce(testing::Return(Fake<jclass>(1)));
+  EXPECT_CALL(*env_, CallObjectMethodV(Fake<jobject>(2), _, _))
+      .WillOnce(testing::Return(Fake<jclass>(2)));
+
+  // IDs must be resolved against each of them.
+  EXPECT_CALL(*env_, GetMethodID(AsGlobal(Fake<jclass>(1)), StrEq("Foo"),
+                                 StrEq("()V")))
+      .WillOnce(testing::Return(Fake<jmethodID>(1)));
+  EXPECT_CALL(*env_, GetMethodID(AsGlobal(Fake<jclass>(2)), StrEq("Foo"),
+                                 StrEq("()V")))
+      .WillOnce(testing::Return(Fake<jmethodID>(2)));
+  EXPECT_CALL(*env_, CallVoidMethodV(_, Fake<jmethodID>(1), _));
+  EXPECT_CALL(*env_, CallVoidMethodV(_, Fake<jmethodID>(2), _));
+
+  {
+    JvmRef<kJvm> jvm_ref{jvm_.get()};
+    LocalClassLoader<kClassLoader, kJvm> class_loader{Fake<jobject>(1)};
+    class_loader.BuildLocalObject<kClass>()("Foo");
+  }
+
+  {
+    JvmRef<kJvm> jvm_ref{jvm_.get()};
+    LocalClassLoader<kClassLoader, kJvm> class_loader{Fake<jobject>(2)};
+    class_loader.BuildLocalObject<kClass>()("Foo");
+  }
+
+  // Default loaded classes were released by each |JvmRef|.
+  default_globals_made_that_should_be_released_.clear();
+}
+
+TEST_F(JniTestWithNoDefaultJvmRef,
+       ClassLoaderRefTest_InterleavesObjectsOfLiveLoaderInstances) {
+  static constexpr Class kClass{"com/google/kClass",
+                                Method{"Foo", Return{}, Params{}}};
+  static constexpr ClassLoader kClassLoader{kNullClassLoader,
+                                            SupportedClassSet{kClass}};
+  static constexpr Jvm kJvm{kClassLoader};
+
+  EXPECT_CALL(*env_, GetMethodID).Times(testing::AnyNumber());
+
+  // Each loader instance loads its own jclass once.
+  EXPECT_CALL(*env_, CallObjectMethodV(Fake<jobject>(1), _, _))
+      .WillOnce(testing::Return(Fake<jclass>(1)));
+  EXPECT_CALL(*env_, CallObjectMethodV(Fake<jobject>(2), _, _))
+      .WillOnce(testing::Return(Fake<jclass>(2)));
+
+  // Objects are built with their own loader's class.
+  EXPECT_CALL(*env_, NewObjectV(AsGlobal(Fake<jclass>(1)), _, _))
+      .WillOnce(testing::Return(Fake<jobject>(11)));
+  EXPECT_CALL(*env_, NewObjectV(AsGlobal(Fake<jclass>(2)), _, _))
+      .WillOnce(testing::Return(Fake<jobject>(12)));
+  ON_CALL(*env_, IsInstanceOf)
+      .WillByDefault(testing::Invoke([](jobject object, jclass clazz) {
+        return (object == Fake<jobject>(11) &&
+                clazz == AsGlobal(Fake<jclass>(1))) ||
+               (object == Fake<jobject>(12) &&
+                clazz == AsGlobal(Fake<jclass>(2)));
+      }));
+
+  // IDs are resolved once against each class and never mixed up, whatever
+  // the order of calls.
+  EXPECT_CALL(*env_, GetMethodID(AsGlobal(Fake<jclass>(1)), StrEq("Foo"),
+                                 StrEq("()V")))
+      .WillOnce(testing::Return(Fake<jmethodID>(1)));
+  EXPECT_CALL(*env_, GetMethodID(AsGlobal(Fake<jclass>(2)), StrEq("Foo"),
+                                 StrEq("()V")))
+      .WillOnce(testing::Return(Fake<jmethodID>(2)));
+  EXPECT_CALL(*env_, CallVoidMethodV(Fake<jobject>(11), Fake<jmethodID>(1), _))
+      .Times(3);
+  EXPECT_CALL(*env_, CallVoidMethodV(Fake<jobject>(12), Fake<jmethodID>(2), _))
+      .Times(3);
+
+  // Each loader's class is released once, on teardown.
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jclass>(1))));
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jclass>(2))));
+
+  JvmRef<kJvm> jvm_ref{jvm_.get()};
+  LocalClassLoader<kClassLoader, kJvm> class_loader_1{Fake<jobject>(1)};
+  LocalClassLoader<kClassLoader, kJvm> class_loader_2{Fake<jobject>(2)};
+  LocalObject<kClass, kClassLoader, kJvm> obj_1 =
+      class_loader_1.BuildLocalObject<kClass>();
+  LocalObject<kClass, kClassLoader, kJvm> obj_2 =
+      class_loader_2.BuildLocalObject<kClass>();
+
+  obj_1("Foo");
+  obj_2("Foo");
+  obj_2("Foo");
+  obj_1("Foo");
+  obj_1("Foo");
+  obj_2("Foo");
+
+  obj_1.Release();
+  obj_2.Release();
+  TearDown();
+}
+
+TEST_F(JniTestWithNoDefaultJvmRef,
+       ClassLoaderRefTest_LoadsTheClassOfAnObjectFromAnotherLoaderInstance) {
+  static constexpr Class kClass{"com/google/kClass",
+                                Method{"Foo", Return{}, Params{}}};
+  static constexpr ClassLoader kClassLoader{kNullClassLoader,
+                                            SupportedClassSet{kClass}};
+  static constexpr Jvm kJvm{kClassLoader};
+
+  EXPECT_CALL(*env_, GetMethodID).Times(testing::AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef).Times(testing::AnyNumber());
+
+  // The first loader instance builds an object.
+  EXPECT_CALL(*env_, CallObjectMethodV(Fake<jobject>(1), _, _))
+      .WillOnce(testing::Return(Fake<jclass>(1)));
+  EXPECT_CALL(*env_, NewObjectV(AsGlobal(Fake<jclass>(1)), _, _))
+      .WillOnce(testing::Return(Fake<jobject>(11)));
+  ON_CALL(*env_, IsInstanceOf)
+      .WillByDefault(testing::Invoke([](jobject object, jclass clazz) {
+        return object == Fake<jobject>(11) &&
+               clazz == AsGlobal(Fake<jclass>(1));
+      }));
+
+  // An object from Java isn't of its class, so its own loader is looked up
+  // (once) and the class is loaded through it.
+  EXPECT_CALL(*env_, GetObjectClass(Fake<jobject>(12)))
+      .WillOnce(testing::Return(Fake<jclass>(3)));
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("getClassLoader"),
+                                 StrEq("()Ljava/lang/ClassLoader;")))
+      .WillOnce(testing::Return(Fake<jmethodID>(3)));
+  EXPECT_CALL(*env_, CallObjectMethodV(Fake<jclass>(3), Fake<jmethodID>(3), _))
+      .WillOnce(testing::Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, CallObjectMethodV(Fake<jobject>(2), _, _))
+      .WillOnce(testing::Return(Fake<jclass>(2)));
+  EXPECT_CALL(*env_, IsInstanceOf).Times(testing::AnyNumber());
+  EXPECT_CALL(*env_, IsInstanceOf(Fake<jobject>(12), AsGlobal(Fake<jclass>(2))))
+      .WillOnce(testing::Return(JNI_TRUE));
+
+  EXPECT_CALL(*env_, GetMethodID(AsGlobal(Fake<jclass>(1)), StrEq("Foo"),
+                                 StrEq("()V")))
+      .WillOnce(testing::Return(Fake<jmethodID>(1)));
+  EXPECT_CALL(*env_, GetMethodID(AsGlobal(Fake<jclass>(2)), StrEq("Foo"),
+                                 StrEq("()V")))
+      .WillOnce(testing::Return(Fake<jmethodID>(2)));
+  EXPECT_CALL(*env_, CallVoidMethodV(Fake<jobject>(11), Fake<jmethodID>(1), _))
+      .Times(2);
+  EXPECT_CALL(*env_, CallVoidMethodV(Fake<jobject>(12), Fake<jmethodID>(2), _))
+      .Times(2);
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jclass>(1))));
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jclass>(2))));
+
+  JvmRef<kJvm> jvm_ref{jvm_.get()};
+  LocalClassLoader<kClassLoader, kJvm> class_loader{Fake<jobject>(1)};
+  LocalObject<kClass, kClassLoader, kJvm> obj_1 =
+      class_loader.BuildLocalObject<kClass>();
+  LocalObject<kClass, kClassLoader, kJvm> obj_2{Fake<jobject>(12)};
+
+  obj_1("Foo");
+  obj_2("Foo");
+  obj_2("Foo");
+  obj_1("Foo");
+
+  obj_1.Release();
+  obj_2.Release();
+  TearDown();
+}
+
+TEST_F(JniTest, LoaderLoadedClassCache_SharesClassesAndDropsCollectedLoaders) {
+  jni::LoaderLoadedClassCache& cache = jni::GetLoaderLoadedClassCache();
+
+  // Hits are borrowed from the cache rather than minting new globals.
+  EXPECT_CALL(*env_, NewGlobalRef(Fake<jclass>(1))).Times(1);
+  jclass cached = cache.Insert(Fake<jobject>(1), "kClass", Fake<jclass>(1));
+  EXPECT_EQ(cached, AsGlobal(Fake<jclass>(1)));
+  EXPECT_EQ(cache.Find(Fake<jobject>(1), "kClass"), cached);
+  EXPECT_EQ(cache.Insert(Fake<jobject>(1), "kClass", Fake<jclass>(1)), cached);
+  EXPECT_EQ(cache.Find(Fake<jobject>(1), "kOtherClass"), nullptr);
+  EXPECT_EQ(cache.Find(Fake<jobject>(2), "kClass"), nullptr);
+
+  // Once the loader is collected, its entry is dropped (and its class is
+  // released on teardown).
+  EXPECT_CALL(*env_, IsSameObject).Times(testing::AnyNumber());
+  EXPECT_CALL(*env_, IsSameObject(AsWeak(Fake<jobject>(1)), nullptr))
+      .WillOnce(testing::Return(JNI_TRUE));
+  EXPECT_CALL(*env_, DeleteWeakGlobalRef(AsWeak(Fake<jobject>(1))));
+  EXPECT_EQ(cache.Find(Fake<jobject>(1), "kClass"), nullptr);
+
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jclass>(1))));
+}
+
+TEST_F(JniTestWithNoDefaultJvmRef,
+       ClassLoaderRefTest_ClassesAreLoadedOncePerLoaderInstanceAndName) {
+  static constexpr Class kClass{"com/google/Shared",
+                                Method{"Foo", Return{}, Params{}}};
+  static constexpr ClassLoader kClassLoader{kNullClassLoader,
+                                            SupportedClassSet{kClass}};
+  static constexpr Jvm kJvm{kClassLoader};
+
+  EXPECT_CALL(*env_, GetMethodID).Times(testing::AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef).Times(testing::AnyNumber());
+  EXPECT_CALL(*env_, DeleteGlobalRef).Times(testing::AnyNumber());
+
+  // Loader lookup IDs are cached.
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("getClassLoader"),
+                                 StrEq("()Ljava/lang/ClassLoader;")))
+      .WillOnce(testing::Return(Fake<jmethodID>(2)));
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("loadClass"),
+                                 StrEq("(Ljava/lang/String;)Ljava/lang/Class;")))
+      .WillOnce(testing::Return(Fake<jmethodID>(1)));
+
+  // Each object's loader is resolved and the object's jclass is released.
+  EXPECT_CALL(*env_, GetObjectClass(Fake<jobject>(1)))
+      .Times(2)
+      .WillRepeatedly(testing::Return(Fake<jclass>(1)));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jclass>(1))).Times(2);
+  EXPECT_CALL(*env_, CallObjectMethodV(Fake<jclass>(1), Fake<jmethodID>(2), _))
+      .Times(2)
+      .WillRepeatedly(testing::Return(Fake<jobject>(3)));
+  EXPECT_CALL(*env_, IsSameObject).Times(testing::AnyNumber());
+  EXPECT_CALL(*env_, IsSameObject(AsWeak(Fake<jobject>(3)), Fake<jobject>(3)))
+      .WillOnce(testing::Return(JNI_TRUE));
+
+  // But the same loader instance only loads the same name once.
+  EXPECT_CALL(*env_, CallObjectMethodV(Fake<jobject>(3), Fake<jmethodID>(1), _))
+      .WillOnce(testing::Return(Fake<jobject>(2)));
+
+  // And both class refs share a single global to the loaded class.
+  EXPECT_CALL(*env_, NewGlobalRef).Times(testing::AnyNumber());
+  EXPECT_CALL(*env_, NewGlobalRef(Fake<jobject>(2))).Times(1);
+
+  // Distinct class refs (default and fully specified jvm) share the load.
+  JvmRef<kJvm> jvm_ref{jvm_.get()};
+  LocalObject<kClass, kClassLoader, kJvm> a{Fake<jobject>(1)};
+  LocalObject<kClass, kClassLoader> b{Fake<jobject>(1)};
+  a("Foo");
+  b("Foo");
+
+  TearDown();
+}
+
 TEST_F(JniTestWithNoDefaultJvmRef,
        ClassLoaderRefTest_ClassesOfDifferentClassLoadersAreUnique) {
   static constexpr Class class_under_test{
@@ -339,9 +587,6 @@ TEST_F(JniTestWithNoDefaultJvmRef,
   EXPECT_CALL(*env_, FindClass(StrEq("java/lang/Class")))
       .WillOnce(testing::Return(Fake<jclass>(2)));
 
-  EXPECT_CALL(*env_, FindClass(StrEq("java/lang/ClassLoader")))
-      .WillOnce(testing::Return(Fake<jclass>(3)));
-
   EXPECT_CALL(*env_, GetObjectClass(Fake<jobject>(1)))
       .WillOnce(testing::Return(Fake<jclass>(1)));
 
@@ -353,6 +598,9 @@ TEST_F(JniTestWithNoDefaultJvmRef,
   EXPECT_CALL(*env_, CallObjectMethodV(Fake<jclass>(1), Fake<jmethodID>(2), _))
       .WillOnce(testing::Return(Fake<jobject>(3)));
 
+  EXPECT_CALL(*env_, FindClass(StrEq("java/lang/ClassLoader")))
+      .WillOnce(testing::Return(Fake<jclass>(3)));
+
   EXPECT_CALL(*env_,
               GetMethodID(Eq(AsGlobal(Fake<jclass>(3))), StrEq("loadClass"),
                           StrEq("(Ljava/lang/String;)Ljava/lang/Class;")))
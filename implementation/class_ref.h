@@ -18,7 +18,13 @@
 #define JNI_BIND_CLASS_REF_H_
 
 #include <atomic>
+#include <cstddef>
+#include <functional>
 #include <mutex>  // NOLINT
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include "class_defs/java_lang_classes.h"
@@ -34,19 +40,126 @@
 #include "implementation/method.h"
 #include "implementation/selector_static_info.h"
 #include "jni_dep.h"
+#include "metaprogramming/concurrent_registry.h"
 #include "metaprogramming/double_locked_value.h"
 
 namespace jni {
 
 // See JvmRef::~JvmRef.
-static std::vector<metaprogramming::DoubleLockedValue<jclass>*>&
+static metaprogramming::ConcurrentRegistry<
+    metaprogramming::DoubleLockedValue<jclass>*>&
 GetDefaultLoadedClassList() {
+  static auto* ret_val = new metaprogramming::ConcurrentRegistry<
+      metaprogramming::DoubleLockedValue<jclass>*>{};
+  return *ret_val;
+}
+
+// See JvmRef::~JvmRef.
+static inline auto& GetDefaultLoadedMethodList() {
   static auto* ret_val =
-      new std::vector<metaprogramming::DoubleLockedValue<jclass>*>{};
+      new metaprogramming::ConcurrentRegistry<
+          metaprogramming::DoubleLockedValue<jmethodID>*>{};
   return *ret_val;
 }
 
-static inline jclass LoadClassFromObject(const char* name, jobject object_ref);
+// Classes loaded by name through a runtime class loader instance (see
+// |LoadClassFromLoader|).  The loader is held weakly so the cache never keeps
+// it reachable by itself, and the class is a global owned by the cache.
+struct LoaderLoadedClass {
+  jobject loader_;
+  std::string name_;
+  jclass clazz_;
+};
+
+// See JvmRef::~JvmRef.
+//
+// Entries are bucketed by a hash of their name, so a lookup only compares
+// loaders that loaded that name.  The cached classes are borrowed (not copied)
+// by every |ClassRef| that resolves through them.
+class LoaderLoadedClassCache {
+ public:
+  // Returns the cached class (owned by the cache) or nullptr on a miss.
+  jclass Find(jobject loader, std::string_view name) {
+    std::lock_guard<std::mutex> lock_guard{lock_};
+    return FindLocked(loader, name);
+  }
+
+  // Caches a global to |clazz| as loaded by |loader| and returns the cached
+  // class.  If another thread raced to cache the same load, its class is
+  // returned instead.  |clazz| is not consumed.
+  jclass Insert(jobject loader, std::string_view name, jclass clazz) {
+    std::lock_guard<std::mutex> lock_guard{lock_};
+    if (jclass cached = FindLocked(loader, name)) {
+      return cached;
+    }
+
+    jclass global_clazz = static_cast<jclass>(
+        LifecycleHelper<jobject, LifecycleType::GLOBAL>::NewReference(clazz));
+    entries_[std::hash<std::string_view>{}(name)].push_back(LoaderLoadedClass{
+        LifecycleHelper<jobject, LifecycleType::WEAK>::NewReference(loader),
+        std::string{name}, global_clazz});
+
+    return global_clazz;
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock_guard{lock_};
+    for (auto& [name_hash, entries] : entries_) {
+      for (const LoaderLoadedClass& entry : entries) {
+        LifecycleHelper<jobject, LifecycleType::WEAK>::Delete(entry.loader_);
+        LifecycleHelper<jobject, LifecycleType::GLOBAL>::Delete(entry.clazz_);
+      }
+    }
+    entries_.clear();
+
+    for (jclass clazz : retired_classes_) {
+      LifecycleHelper<jobject, LifecycleType::GLOBAL>::Delete(clazz);
+    }
+    retired_classes_.clear();
+  }
+
+ private:
+  jclass FindLocked(jobject loader, std::string_view name) {
+    auto bucket = entries_.find(std::hash<std::string_view>{}(name));
+    if (bucket == entries_.end()) {
+      return nullptr;
+    }
+
+    std::vector<LoaderLoadedClass>& entries = bucket->second;
+    for (auto it = entries.begin(); it != entries.end();) {
+      if (LifecycleHelper<jobject, LifecycleType::WEAK>::IsCleared(
+              it->loader_)) {
+        // The loader was collected, so nothing can ask for it again.  The
+        // class may have been defined by a parent and still be in use through
+        // a |ClassRef|, so it is only released on teardown.
+        LifecycleHelper<jobject, LifecycleType::WEAK>::Delete(it->loader_);
+        retired_classes_.push_back(it->clazz_);
+        it = entries.erase(it);
+      } else if (it->name_ == name &&
+                 JniHelper::IsSameObject(it->loader_, loader)) {
+        return it->clazz_;
+      } else {
+        ++it;
+      }
+    }
+
+    return nullptr;
+  }
+
+  std::mutex lock_;
+
+  // Keyed on the hash of the name so lookups don't allocate.
+  std::unordered_map<std::size_t, std::vector<LoaderLoadedClass>> entries_;
+  std::vector<jclass> retired_classes_;
+};
+
+static inline LoaderLoadedClassCache& GetLoaderLoadedClassCache() {
+  static auto* ret_val = new LoaderLoadedClassCache{};
+  return *ret_val;
+}
+
+static inline jclass LoadClassFromLoader(const char* name, jobject loader);
+static inline jobject GetClassLoaderOfObject(jobject object_ref);
 
 // Represents a a jclass instance for a specific class. 4 flavours exist:
 //   1) Default JVM, default class loader.
@@ -54,6 +167,10 @@ static inline jclass LoadClassFromObject(const char* name, jobject object_ref);
 //   3) Default JVM, non-default class loader.
 //   4) Non-default JVM, non default class loader (i.e. fully specified).
 //
+// For non-default class loaders, every runtime instance of the loader
+// definition loads its own jclass, and method and field IDs are cached per
+// jclass, so objects of several live loader instances can be used side by side.
+//
 // Use |ClassRef_t| to provide |JniT| in its minimal form.
 template <typename JniT>
 class ClassRef {
@@ -61,9 +178,46 @@ class ClassRef {
   static_assert(std::is_same_v<JniT, typename JniT::MinimallySpanningType>,
                 "JniT must be in its minimal form for best caching.");
 
-  template <typename Lambda>
-  static void PrimeJClassFromClassLoader(Lambda lambda) {
-    class_ref_.LoadAndMaybeInit(lambda);
+  // While alive, objects of this class built on this thread use |clazz|, as
+  // an object under construction has no reference to find its loader from.
+  // See |ClassLoaderRef::BuildLocalObject|.
+  class BuildScope {
+   public:
+    explicit BuildScope(jclass clazz) : clazz_(clazz), enclosing_(building_) {
+      building_ = this;
+    }
+
+    BuildScope(const BuildScope&) = delete;
+    BuildScope& operator=(const BuildScope&) = delete;
+
+    ~BuildScope() { building_ = enclosing_; }
+
+   private:
+    friend class ClassRef;
+
+    const jclass clazz_;
+    BuildScope* const enclosing_;
+  };
+
+  // Loads the class through |loader|, a runtime instance of this class's
+  // loader definition, and returns it (nullptr if it couldn't be loaded).
+  static jclass PrimeJClassFromClassLoader(jobject loader) {
+    jclass clazz = LoadClassFromLoader(JniT::kNameWithDots.data(), loader);
+    if (clazz == nullptr) {
+      return nullptr;
+    }
+
+    // The first class loaded takes the lock free path.
+    if (class_ref_.LoadAndMaybeInit([=]() { return clazz; }) == clazz) {
+      return clazz;
+    }
+
+    std::lock_guard<std::mutex> lock_guard{lock_};
+    if (FindOtherClassLocked(clazz) == nullptr) {
+      other_classes_.push_back(OtherClass{clazz, {}, {}});
+    }
+
+    return clazz;
   }
 
   static jclass GetAndMaybeLoadClassRef(
@@ -72,7 +226,7 @@ class ClassRef {
     if constexpr (JniT::GetClassLoader() == kDefaultClassLoader) {
       static metaprogramming::DoubleLockedValue<jclass> return_value;
       return return_value.LoadAndMaybeInit([]() {
-        GetDefaultLoadedClassList().push_back(&return_value);
+        GetDefaultLoadedClassList().Register(&return_value);
 
         // FindClass uses plain name (e.g. "kClass") for rank 0, qualified
         // class names when used in arrays (e.g. "[LkClass;"). This doesn't
@@ -91,11 +245,21 @@ class ClassRef {
         }
       });
     } else {
-      // For non default classloader, storage in class member.
-      return class_ref_.LoadAndMaybeInit([=]() {
-        return LoadClassFromObject(JniT::kNameWithDots.data(),
-                                   optional_object_to_build_loader_from);
-      });
+      if (BuildScope* build_scope = building_) {
+        return build_scope->clazz_;
+      }
+
+      // Statics and arrays have no object to pick a loader instance from,
+      // so they use the first class loaded.
+      jclass first_class = GetAlreadyLoadedClassRef();
+      jobject object = optional_object_to_build_loader_from;
+      if (object == nullptr ||
+          (first_class != nullptr &&
+           JniHelper::IsInstanceOf(object, first_class))) {
+        return first_class;
+      }
+
+      return LoadClassOfObject(object);
     }
   }
 
@@ -103,29 +267,183 @@ class ClassRef {
     return class_ref_.LoadAndMaybeInit([]() { return jclass{0}; });
   }
 
+  // Returns the method or field ID cached in |id| (a function local static
+  // per ID) for |clazz|, resolving it with |resolve| on a miss.  |id| holds
+  // the ID for the first class loaded, other classes cache theirs here.
+  template <typename IdT, typename Resolve>
+  static IdT LoadAndMaybeInitId(jclass clazz,
+                                metaprogramming::DoubleLockedValue<IdT>& id,
+                                Resolve resolve) {
+    if (clazz == GetAlreadyLoadedClassRef()) {
+      return id.LoadAndMaybeInit([&]() {
+        if constexpr (std::is_same_v<IdT, jmethodID>) {
+          loaded_method_list_.Register(&id);
+        } else {
+          loaded_field_list_.Register(&id);
+        }
+
+        return resolve();
+      });
+    }
+
+    std::lock_guard<std::mutex> lock_guard{lock_};
+    OtherClass* other_class = FindOtherClassLocked(clazz);
+    if (other_class == nullptr) {
+      return resolve();
+    }
+
+    auto& ids = [&]() -> auto& {
+      if constexpr (std::is_same_v<IdT, jmethodID>) {
+        return other_class->method_ids_;
+      } else {
+        return other_class->field_ids_;
+      }
+    }();
+    auto [it, inserted] = ids.try_emplace(&id, IdT{});
+    if (inserted) {
+      it->second = resolve();
+    }
+
+    return it->second;
+  }
+
+  // Only called on teardown (see JvmRef::~JvmRef).  The classes themselves are
+  // owned by |GetLoaderLoadedClassCache|.
   static void MaybeReleaseClassRef() {
-    class_ref_.Reset([](jclass maybe_loaded_class) {
-      LifecycleHelper<jclass, LifecycleType::GLOBAL>::Delete(
-          maybe_loaded_class);
-    });
+    class_ref_.Reset();
+
+    {
+      std::lock_guard<std::mutex> lock_guard{lock_};
+      other_classes_.clear();
+    }
+
+    // IDs are only valid for the jclass they were resolved against.
+    loaded_method_list_.ForEach(
+        [](metaprogramming::DoubleLockedValue<jmethodID>* cached_method_id) {
+          cached_method_id->Reset();
+        });
+    loaded_method_list_.Clear();
+
+    loaded_field_list_.ForEach(
+        [](metaprogramming::DoubleLockedValue<jfieldID>* cached_field_id) {
+          cached_field_id->Reset();
+        });
+    loaded_field_list_.Clear();
   }
 
  private:
-  // A global reference to a jclass object that is returned from FindClass.
+  // A class loaded through another loader instance than |class_ref_|, and the
+  // IDs resolved against it, keyed by their function local static.
+  struct OtherClass {
+    jclass clazz_;
+    std::unordered_map<const void*, jmethodID> method_ids_;
+    std::unordered_map<const void*, jfieldID> field_ids_;
+  };
+
+  static OtherClass* FindOtherClassLocked(jclass clazz) {
+    for (OtherClass& other_class : other_classes_) {
+      if (other_class.clazz_ == clazz) {
+        return &other_class;
+      }
+    }
+
+    return nullptr;
+  }
+
+  // Finds the class of |object| (which isn't |class_ref_|) among the classes
+  // of other loader instances, loading it through |object|'s loader if none
+  // match.
+  static jclass LoadClassOfObject(jobject object) {
+    {
+      std::lock_guard<std::mutex> lock_guard{lock_};
+      for (const OtherClass& other_class : other_classes_) {
+        if (JniHelper::IsInstanceOf(object, other_class.clazz_)) {
+          return other_class.clazz_;
+        }
+      }
+    }
+
+    jobject loader = GetClassLoaderOfObject(object);
+    jclass clazz = PrimeJClassFromClassLoader(loader);
+    LifecycleHelper<jobject, LifecycleType::LOCAL>::Delete(loader);
+
+    return clazz;
+  }
+
+  // A global reference to a jclass object that is returned from loadClass,
+  // borrowed from |GetLoaderLoadedClassCache|.  This is the first class loaded
+  // (i.e. of the first loader instance), looked up without locking.
   // The variable has static storage because ClassIDs are static to the lifetime
   // of a JVM.  See GetAndMaybeLoadClassRef and MaybeReleaseClassRef.
   static inline metaprogramming::DoubleLockedValue<jclass> class_ref_;
+
+  // Classes of other loader instances, also borrowed.  Like the cache, these
+  // are kept until teardown even if their loader is collected.
+  static inline std::mutex lock_;
+  static inline std::vector<OtherClass> other_classes_;
+
+  static inline thread_local BuildScope* building_ = nullptr;
+
+  // IDs resolved against |class_ref_|.  These are forgotten alongside the
+  // class in |MaybeReleaseClassRef|, so a class reloaded after teardown never
+  // reuses IDs from the previous one.  Classes have few members relative to
+  // the default lists, so use a small chunk size.
+  static inline metaprogramming::ConcurrentRegistry<
+      metaprogramming::DoubleLockedValue<jmethodID>*, 16>
+      loaded_method_list_;
+  static inline metaprogramming::ConcurrentRegistry<
+      metaprogramming::DoubleLockedValue<jfieldID>*, 8>
+      loaded_field_list_;
 };
 
+// Loads |name| through |loader| (a runtime ClassLoader instance), sharing the
+// load with any other class definition that asks the same loader for the same
+// name.  The returned class is owned by |GetLoaderLoadedClassCache|.
+static inline jclass LoadClassFromLoader(const char* name, jobject loader) {
+  static metaprogramming::DoubleLockedValue<jmethodID> load_class_jmethod;
+
+  if (jclass cached_jclass = GetLoaderLoadedClassCache().Find(loader, name)) {
+    return cached_jclass;
+  }
+
+  jclass java_lang_class_loader_jclass =
+      ClassRef<JniT<jobject, kJavaLangClassLoader>>::GetAndMaybeLoadClassRef(
+          nullptr);
+
+  jmethodID load_class = load_class_jmethod.LoadAndMaybeInit([=]() {
+    GetDefaultLoadedMethodList().Register(&load_class_jmethod);
+    return JniHelper::GetMethodID(java_lang_class_loader_jclass, "loadClass",
+                                  "(Ljava/lang/String;)Ljava/lang/Class;");
+  });
+
+  jstring name_string =
+      LifecycleHelper<jstring, LifecycleType::LOCAL>::Construct(name);
+  jobject local_jclass_object = InvokeHelper<jobject, 1, false>::Invoke(
+      loader, nullptr, load_class, name_string);
+  jclass local_jclass = static_cast<jclass>(local_jclass_object);
+  LifecycleHelper<jstring, LifecycleType::LOCAL>::Delete(name_string);
+
+  if (local_jclass == nullptr) {
+    return nullptr;
+  }
+
+  jclass jclass_of_correct_loader =
+      GetLoaderLoadedClassCache().Insert(loader, name, local_jclass);
+  LifecycleHelper<jobject, LifecycleType::LOCAL>::Delete(local_jclass);
+
+  return jclass_of_correct_loader;
+}
+
 // When we get an object_ref_ as a return value from a Java method, it may be
 // an instance of a subclass of ClassRefT. In this case, if we directly used
 // the object_ref_'s class, then we might incorrectly get member information
 // for the subclass instead of the original class. However, the original class
-// should still be loadable from the subclass's class loader, so we load the
-// ClassRef explicitly by class name.
-static inline jclass LoadClassFromObject(const char* name, jobject object_ref) {
+// should still be loadable from the subclass's class loader, so the ClassRef
+// is loaded explicitly by name through the loader returned here (a local).
+static inline jobject GetClassLoaderOfObject(jobject object_ref) {
   // We cannot refer to the wrapper MethodRefs here, so we just manually use
   // the class loader through JNI.
+  static metaprogramming::DoubleLockedValue<jmethodID> get_class_loader_jmethod;
 
   // Gets the ClassLoader of java/lang/class (the primordial loader).
   // Note, these aren't static methods, they're member methods to be invoked
@@ -134,37 +452,22 @@ static inline jclass LoadClassFromObject(const char* name, jobject object_ref) {
   jclass java_lang_class_jclass =
       ClassRef<JniT<jobject, kJavaLangClass>>::GetAndMaybeLoadClassRef(nullptr);
 
-  jclass java_lang_class_loader_jclass =
-      ClassRef<JniT<jobject, kJavaLangClassLoader>>::GetAndMaybeLoadClassRef(
-          nullptr);
-
   jclass class_of_object_jclass = JniHelper::GetObjectClass(object_ref);
 
-  jmethodID get_class_loader_jmethod = JniHelper::GetMethodID(
-      java_lang_class_jclass, "getClassLoader", "()Ljava/lang/ClassLoader;");
-
   jobject object_ref_class_loader_jobject =
-      InvokeHelper<jobject, 1, false>::Invoke(class_of_object_jclass, nullptr,
-                                              get_class_loader_jmethod);
-
-  jmethodID load_class_jmethod =
-      JniHelper::GetMethodID(java_lang_class_loader_jclass, "loadClass",
-                             "(Ljava/lang/String;)Ljava/lang/Class;");
-
-  jstring name_string =
-      LifecycleHelper<jstring, LifecycleType::LOCAL>::Construct(name);
-  jobject local_jclass_of_correct_loader =
-      InvokeHelper<jobject, 1, false>::Invoke(object_ref_class_loader_jobject,
-                                              nullptr, load_class_jmethod,
-                                              name_string);
-  jobject promote_jclass_of_correct_loader =
-      LifecycleHelper<jobject, LifecycleType::GLOBAL>::Promote(
-          local_jclass_of_correct_loader);
+      InvokeHelper<jobject, 1, false>::Invoke(
+          class_of_object_jclass, nullptr,
+          get_class_loader_jmethod.LoadAndMaybeInit([=]() {
+            GetDefaultLoadedMethodList().Register(&get_class_loader_jmethod);
+            return JniHelper::GetMethodID(java_lang_class_jclass,
+                                          "getClassLoader",
+                                          "()Ljava/lang/ClassLoader;");
+          }));
 
   LifecycleHelper<jobject, LifecycleType::LOCAL>::Delete(
-      object_ref_class_loader_jobject);
+      class_of_object_jclass);
 
-  return static_cast<jclass>(promote_jclass_of_correct_loader);
+  return object_ref_class_loader_jobject;
 }
 
 template <typename JniT>
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_DIRECT_BUFFER_H_
+#define JNI_BIND_IMPLEMENTATION_DIRECT_BUFFER_H_
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "class_defs/java_nio_classes.h"
+#include "implementation/jni_helper/jni_helper.h"
+#include "implementation/local_object.h"
+#include "jni_dep.h"
+
+namespace jni {
+
+// Represents a direct java.nio.ByteBuffer whose memory is native, viewed as
+// contiguous elements of |T|.  No copies are made in either direction, so
+// this is suitable for handing large payloads between C++ and Java.
+//
+// DirectBuffer can be passed wherever a |kJavaNioByteBuffer| is accepted, and
+// built from a |kJavaNioByteBuffer| return value or field:
+//
+//   static constexpr Class kClass{
+//       "kClass",
+//       Method{"Consume", Return{}, Params{kJavaNioByteBuffer}},
+//       Method{"Produce", Return{kJavaNioByteBuffer}, Params{}}};
+//
+//   std::vector<float> payload(1024);
+//   DirectBuffer<float> in{payload.data(), payload.size()};
+//   obj("Consume", in);
+//
+//   DirectBuffer<float> out{obj("Produce")};
+//   for (float val : out) { ... }
+//
+// Non-direct buffers have a null |data()| and a |size()| of 0.  The native
+// memory must be suitably aligned for |T|.
+//
+// Wrapping fails (leaving a null buffer with a null |data()|) if the JVM
+// doesn't support direct buffers or |size| is larger than |kMaxSize|.
+template <typename T>
+class DirectBuffer : public LocalObject<kJavaNioByteBuffer> {
+ public:
+  static_assert(std::is_trivially_copyable_v<T>,
+                "DirectBuffer elements are shared as raw memory with Java.");
+
+  using Base = LocalObject<kJavaNioByteBuffer>;
+
+  using value_type = T;
+  using iterator = T*;
+  using const_iterator = const T*;
+
+  // Largest number of elements whose size in bytes fits a jlong capacity (and
+  // a std::size_t).
+  static constexpr std::size_t kMaxSize =
+      (static_cast<unsigned long long>(std::numeric_limits<jlong>::max()) <
+               std::numeric_limits<std::size_t>::max()
+           ? static_cast<std::size_t>(std::numeric_limits<jlong>::max())
+           : std::numeric_limits<std::size_t>::max()) /
+      sizeof(T);
+
+  // Wraps |size| elements of caller owned memory at |data|.
+  //
+  // Java can't signal when it is done with the buffer, so |data| must outlive
+  // every use of the buffer in Java (including any references Java retains),
+  // not just this object.
+  DirectBuffer(T* data, std::size_t size) : Base(NewBuffer(data, size)) {
+    if (static_cast<jobject>(*this) != nullptr) {
+      data_ = data;
+      size_ = size;
+    }
+  }
+
+  // Adopts a local java.nio.ByteBuffer (e.g. a method return value).
+  explicit DirectBuffer(jobject buffer) : Base(buffer) { Init(); }
+
+  DirectBuffer(LocalObject<kJavaNioByteBuffer>&& obj) : Base(obj.Release()) {
+    Init();
+  }
+
+  DirectBuffer(DirectBuffer&& rhs)
+      : Base(rhs.Release()), data_(rhs.data_), size_(rhs.size_) {
+    rhs.data_ = nullptr;
+    rhs.size_ = 0;
+  }
+
+  T* data() const { return data_; }
+  std::size_t size() const { return size_; }
+  std::size_t size_bytes() const { return size_ * sizeof(T); }
+  bool empty() const { return size_ == 0; }
+
+  T& operator[](std::size_t idx) const { return data_[idx]; }
+
+  T* begin() const { return data_; }
+  T* end() const { return data_ + size_; }
+  const T* cbegin() const { return data_; }
+  const T* cend() const { return data_ + size_; }
+
+ private:
+  static jobject NewBuffer(T* data, std::size_t size) {
+    if (size > kMaxSize) {
+      return nullptr;
+    }
+
+    return JniHelper::NewDirectByteBuffer(
+        data, static_cast<jlong>(size * sizeof(T)));
+  }
+
+  void Init() {
+    const jobject buffer = static_cast<jobject>(*this);
+    if (buffer == nullptr) {
+      return;
+    }
+
+    const jlong capacity = JniHelper::GetDirectBufferCapacity(buffer);
+    data_ = static_cast<T*>(JniHelper::GetDirectBufferAddress(buffer));
+    size_ = (data_ == nullptr || capacity < 0)
+                ? 0
+                : static_cast<std::size_t>(capacity) / sizeof(T);
+  }
+
+  T* data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_DIRECT_BUFFER_H_
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Class;
+using ::jni::DirectBuffer;
+using ::jni::Field;
+using ::jni::kJavaNioByteBuffer;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::Return;
+using ::jni::test::Fake;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::ElementsAre;
+
+static constexpr Class kClass{
+    "kClass",
+    Method{"Consume", Return{}, Params{kJavaNioByteBuffer}},
+    Method{"Produce", Return{kJavaNioByteBuffer}, Params{}},
+    Field{"buffer", kJavaNioByteBuffer},
+};
+
+TEST_F(JniTest, DirectBuffer_WrapsCallerOwnedMemory) {
+  std::array<jfloat, 4> payload{1.f, 2.f, 3.f, 4.f};
+
+  EXPECT_CALL(*env_, NewDirectByteBuffer(payload.data(), 4 * sizeof(jfloat)))
+      .WillOnce(::testing::Return(Fake<jobject>()));
+  EXPECT_CALL(*env_, GetDirectBufferAddress).Times(0);
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>()));
+
+  DirectBuffer<jfloat> buffer{payload.data(), payload.size()};
+  EXPECT_EQ(static_cast<jobject>(buffer), Fake<jobject>());
+  EXPECT_EQ(buffer.data(), payload.data());
+  EXPECT_EQ(buffer.size(), 4);
+  EXPECT_EQ(buffer.size_bytes(), 16);
+  EXPECT_THAT(buffer, ElementsAre(1.f, 2.f, 3.f, 4.f));
+}
+
+TEST_F(JniTest, DirectBuffer_IsNullIfTheJvmDoesNotSupportDirectBuffers) {
+  std::array<jfloat, 4> payload{};
+
+  EXPECT_CALL(*env_, NewDirectByteBuffer)
+      .WillOnce(::testing::Return(nullptr));
+
+  DirectBuffer<jfloat> buffer{payload.data(), payload.size()};
+  EXPECT_EQ(static_cast<jobject>(buffer), nullptr);
+  EXPECT_EQ(buffer.data(), nullptr);
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(buffer.begin(), buffer.end());
+}
+
+TEST_F(JniTest, DirectBuffer_RejectsSizesWhoseCapacityOverflows) {
+  std::array<jlong, 1> payload{};
+
+  EXPECT_CALL(*env_, NewDirectByteBuffer).Times(0);
+
+  DirectBuffer<jlong> buffer{payload.data(), DirectBuffer<jlong>::kMaxSize + 1};
+  EXPECT_EQ(static_cast<jobject>(buffer), nullptr);
+  EXPECT_EQ(buffer.data(), nullptr);
+  EXPECT_EQ(buffer.size(), 0);
+}
+
+TEST_F(JniTest, DirectBuffer_ConstIteratorIsReadOnly) {
+  static_assert(
+      std::is_same_v<DirectBuffer<jint>::const_iterator, const jint*>);
+  static_assert(std::is_same_v<decltype(std::declval<DirectBuffer<jint>&>()
+                                            .cbegin()),
+                               const jint*>);
+}
+
+TEST_F(JniTest, DirectBuffer_ViewsReturnedBufferWithoutCopying) {
+  std::array<jint, 8> native_memory{};
+  std::iota(native_memory.begin(), native_memory.end(), 0);
+
+  EXPECT_CALL(*env_, CallObjectMethodV(Fake<jobject>(1), _, _))
+      .WillOnce(::testing::Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, GetDirectBufferAddress(Fake<jobject>(2)))
+      .WillOnce(::testing::Return(native_memory.data()));
+  EXPECT_CALL(*env_, GetDirectBufferCapacity(Fake<jobject>(2)))
+      .WillOnce(::testing::Return(sizeof(native_memory)));
+
+  LocalObject<kClass> obj{Fake<jobject>(1)};
+  DirectBuffer<jint> buffer{obj("Produce")};
+
+  EXPECT_EQ(buffer.size(), 8);
+  EXPECT_EQ(buffer[3], 3);
+  buffer[3] = 123;
+  EXPECT_EQ(native_memory[3], 123);
+}
+
+TEST_F(JniTest, DirectBuffer_NonDirectBuffersAreEmpty) {
+  EXPECT_CALL(*env_, GetDirectBufferAddress)
+      .WillOnce(::testing::Return(nullptr));
+  EXPECT_CALL(*env_, GetDirectBufferCapacity)
+      .WillOnce(::testing::Return(-1));
+
+  DirectBuffer<jbyte> buffer{Fake<jobject>()};
+  EXPECT_EQ(buffer.data(), nullptr);
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(buffer.begin(), buffer.end());
+}
+
+TEST_F(JniTest, DirectBuffer_IsPassableAsByteBufferArgAndField) {
+  std::array<jbyte, 2> payload{};
+
+  EXPECT_CALL(*env_, NewDirectByteBuffer)
+      .WillOnce(::testing::Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, CallVoidMethodV(Fake<jobject>(1), _, _));
+  EXPECT_CALL(*env_, SetObjectField(Fake<jobject>(1), _, Fake<jobject>(2)));
+  EXPECT_CALL(*env_, GetObjectField(Fake<jobject>(1), _))
+      .WillOnce(::testing::Return(Fake<jobject>(3)));
+
+  LocalObject<kClass> obj{Fake<jobject>(1)};
+  DirectBuffer<jbyte> buffer{payload.data(), payload.size()};
+  obj("Consume", buffer);
+  obj["buffer"].Set(buffer);
+
+  DirectBuffer<jbyte> field_buffer{obj["buffer"].Get()};
+  EXPECT_EQ(static_cast<jobject>(field_buffer), Fake<jobject>(3));
+}
+
+TEST_F(JniTest, DirectBuffer_MovesTransferOwnershipAndView) {
+  std::array<jshort, 3> payload{};
+
+  EXPECT_CALL(*env_, NewDirectByteBuffer)
+      .WillOnce(::testing::Return(Fake<jobject>()));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>())).Times(1);
+
+  DirectBuffer<jshort> buffer{payload.data(), payload.size()};
+  DirectBuffer<jshort> moved{std::move(buffer)};
+
+  EXPECT_EQ(moved.data(), payload.data());
+  EXPECT_EQ(moved.size(), 3);
+}
+
+}  // namespace
@@ -31,6 +31,7 @@
 #include "implementation/jni_helper/static_field_value.h"
 #include "implementation/proxy.h"
 #include "jni_dep.h"
+#include "metaprogramming/concurrent_registry.h"
 #include "metaprogramming/double_locked_value.h"
 #include "metaprogramming/optional_wrap.h"
 #include "metaprogramming/queryable_map.h"
@@ -40,7 +41,8 @@ namespace jni {
 // See JvmRef::~JvmRef.
 static inline auto& GetDefaultLoadedFieldList() {
   static auto* ret_val =
-      new std::vector<metaprogramming::DoubleLockedValue<jfieldID>*>{};
+      new metaprogramming::ConcurrentRegistry<
+          metaprogramming::DoubleLockedValue<jfieldID>*>{};
   return *ret_val;
 }
 
@@ -65,11 +67,7 @@ class FieldRef {
   static jfieldID GetFieldID(jclass clazz) {
     static jni::metaprogramming::DoubleLockedValue<jfieldID> return_value;
 
-    return return_value.LoadAndMaybeInit([=]() {
-      if constexpr (JniT::class_loader_v == kDefaultClassLoader) {
-        GetDefaultLoadedFieldList().push_back(&return_value);
-      }
-
+    auto resolve = [=]() {
       if constexpr (IdT::kIsStatic) {
         return jni::JniHelper::GetStaticFieldID(clazz, IdT::Name(),
                                                 Signature_v<IdT>.data());
@@ -77,7 +75,18 @@ class FieldRef {
         return jni::JniHelper::GetFieldID(clazz, IdT::Name(),
                                           Signature_v<IdT>.data());
       }
-    });
+    };
+
+    if constexpr (JniT::class_loader_v == kDefaultClassLoader) {
+      return return_value.LoadAndMaybeInit([=]() {
+        GetDefaultLoadedFieldList().Register(&return_value);
+        return resolve();
+      });
+    } else {
+      // Each loader instance has its own jclass, and so its own IDs.
+      return ClassRef_t<JniT>::LoadAndMaybeInitId(clazz, return_value,
+                                                  resolve);
+    }
   }
 
   using ReturnProxied = Return_t<typename IdT::MaterializeCDeclT, IdT>;
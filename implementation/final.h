@@ -0,0 +1,35 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_FINAL_H_
+#define JNI_BIND_IMPLEMENTATION_FINAL_H_
+
+namespace jni {
+
+// Tag that marks a |Method| or |Class| as final, i.e. it cannot be overridden
+// in Java.  Instance methods of final definitions are invoked through
+// CallNonvirtual<Type>Method with the cached jclass, skipping virtual dispatch.
+//
+// e.g. Method{"Foo", Final{}, Return<int>{}, Params{}}
+//      Class{"kClass", Final{}, Method{...}}
+//
+// Marking a definition as final when the Java side can be overridden will
+// silently bypass the override.
+struct Final {};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_FINAL_H_
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_FLATTENED_ARRAY_H_
+#define JNI_BIND_IMPLEMENTATION_FLATTENED_ARRAY_H_
+
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace jni {
+
+// Contiguous, row-major copy of a rank N (N >= 2) primitive array, e.g. the
+// elements of an int[][] laid out row after row.
+//
+// Java multidimensional arrays are arrays of arrays and may be jagged, so the
+// shape is stored as one list of offsets per level (excluding the innermost):
+//
+//   |offsets[d]| has one entry per element at depth |d| plus one, and element
+//   |i| at depth |d| spans [offsets[d][i], offsets[d][i + 1]) of depth |d + 1|
+//   (or of |data| for the last level).
+//
+// e.g. {{1, 2, 3}, {}, {4}} is data {1, 2, 3, 4} and offsets {{0, 3, 3, 4}}.
+//
+// Rectangular arrays can be built from extents (see |FromExtents|), and
+// queried like an mdspan via |Extents|.
+template <typename SpanType>
+struct FlattenedArray {
+  std::vector<SpanType> data;
+  std::vector<std::vector<std::size_t>> offsets;
+
+  // Builds a rectangular shape, e.g. extents {2, 3} is a float[2][3].
+  // |data| must hold the product of |extents| elements in row-major order.
+  static FlattenedArray FromExtents(const std::vector<std::size_t>& extents,
+                                    std::vector<SpanType> data) {
+    std::size_t num_elements = 1;
+    for (std::size_t extent : extents) {
+      num_elements *= extent;
+    }
+    assert(data.size() == num_elements && "|data| doesn't match |extents|.");
+
+    FlattenedArray ret{std::move(data), {}};
+
+    std::size_t count = 1;
+    for (std::size_t d = 0; d + 1 < extents.size(); ++d) {
+      count *= extents[d];
+
+      std::vector<std::size_t> level(count + 1);
+      for (std::size_t i = 0; i <= count; ++i) {
+        level[i] = i * extents[d + 1];
+      }
+      ret.offsets.push_back(std::move(level));
+    }
+
+    return ret;
+  }
+
+  std::size_t Rank() const { return offsets.size() + 1; }
+
+  // Number of elements at the top level (i.e. Java's |arr.length|).
+  std::size_t Size() const {
+    return offsets.empty() ? 0 : offsets[0].size() - 1;
+  }
+
+  // Number of innermost (rank 1) rows.
+  std::size_t NumRows() const {
+    return offsets.empty() ? 0 : offsets.back().size() - 1;
+  }
+
+  // Returns the innermost row |idx| as a pointer and length.
+  std::pair<const SpanType*, std::size_t> Row(std::size_t idx) const {
+    const std::vector<std::size_t>& row_offsets = offsets.back();
+    return {data.data() + row_offsets[idx],
+            row_offsets[idx + 1] - row_offsets[idx]};
+  }
+
+  // True if every element at each depth has the same length.
+  bool IsRectangular() const {
+    for (const std::vector<std::size_t>& level : offsets) {
+      for (std::size_t i = 1; i + 1 < level.size(); ++i) {
+        if (level[i + 1] - level[i] != level[1] - level[0]) {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  // Length of each dimension, only meaningful if |IsRectangular|.
+  std::vector<std::size_t> Extents() const {
+    std::vector<std::size_t> ret{Size()};
+    for (const std::vector<std::size_t>& level : offsets) {
+      ret.push_back(level.size() > 1 ? level[1] - level[0] : 0);
+    }
+
+    return ret;
+  }
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_FLATTENED_ARRAY_H_
@@ -36,6 +36,9 @@ class LocalObject;
 template <const auto& class_v_, const auto& class_loader_v_, const auto& jvm_v_>
 class GlobalObject;
 
+template <typename T>
+class DirectBuffer;
+
 template <LifecycleType lifecycleType, const auto& jvm_v_,
           const auto& class_loader_v_>
 class ClassLoaderRef;
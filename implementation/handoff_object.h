@@ -0,0 +1,117 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_HANDOFF_OBJECT_H_
+#define JNI_BIND_IMPLEMENTATION_HANDOFF_OBJECT_H_
+
+#include <cassert>
+#include <thread>
+#include <utility>
+
+#include "implementation/default_class_loader.h"
+#include "implementation/global_object.h"
+#include "implementation/jvm.h"
+#include "implementation/local_object.h"
+#include "implementation/shared_global_object.h"
+#include "jni_dep.h"
+
+namespace jni {
+
+// Object which may (or may not) be handed off to another thread.
+//
+// Promoting every object that *might* be sent to a worker costs a
+// NewGlobalRef/DeleteGlobalRef pair, even if it never leaves its thread.  A
+// |HandoffObject| instead holds a local reference, and only promotes it to a
+// global when it is actually handed off with |Transfer| or |Post|:
+//
+//   HandoffObject<kClass> obj{LocalObject<kClass>{}};
+//   obj.Local()("Foo");
+//   if (needs_background_work) {
+//     std::move(obj).Post(executor, [](GlobalObject<kClass>& global) {
+//       global("Bar");
+//     });
+//   }
+//
+// As locals are only valid on the thread (and frame) that created them, both
+// |Local| and the promotion must happen on the creating thread.  Once handed
+// off (or moved from), the object may no longer be used.  Both are asserted in
+// debug builds.
+template <const auto& class_v_,
+          const auto& class_loader_v_ = kDefaultClassLoader,
+          const auto& jvm_v_ = kDefaultJvm>
+class HandoffObject {
+ public:
+  using LocalT = LocalObject<class_v_, class_loader_v_, jvm_v_>;
+  using GlobalT = GlobalObject<class_v_, class_loader_v_, jvm_v_>;
+
+  explicit HandoffObject(LocalT&& local) : local_(std::move(local)) {}
+
+  // Keeps the creating thread of |rhs|, which may no longer be used.
+  HandoffObject(HandoffObject&& rhs)
+      : local_(std::move(rhs.local_)),
+        owner_(rhs.owner_),
+        transferred_(std::exchange(rhs.transferred_, true)) {}
+
+  HandoffObject(const HandoffObject&) = delete;
+  HandoffObject& operator=(const HandoffObject&) = delete;
+  HandoffObject& operator=(HandoffObject&&) = delete;
+
+  // Access on the creating thread, no promotion is performed.
+  LocalT& Local() {
+    assert(std::this_thread::get_id() == owner_ &&
+           "Locals can only be used on the thread that created them.");
+    assert(!transferred_ && "The object has already been handed off.");
+    return local_;
+  }
+
+  // Promotes to a global (releasing the local) which may be moved to, and
+  // used on, any thread.
+  GlobalT Transfer() && {
+    assert(std::this_thread::get_id() == owner_ &&
+           "Locals must be promoted on the thread that created them.");
+    assert(!transferred_ && "The object has already been handed off.");
+    transferred_ = true;
+    return GlobalT{std::move(local_)};
+  }
+
+  // Promotes and submits |func| to |executor|, which is any callable taking a
+  // copyable |void()| task (e.g. one taking a std::function<void()>).  |func|
+  // is invoked with a |GlobalT&| on the executor's thread, which must be
+  // attached (e.g. hold a |ThreadGuard|).
+  template <typename Executor, typename Func>
+  void Post(Executor&& executor, Func&& func) && {
+    SharedGlobalObject<class_v_, class_loader_v_, jvm_v_> shared{
+        std::move(*this).Transfer()};
+
+    std::forward<Executor>(executor)(
+        [shared{std::move(shared)}, func{std::forward<Func>(func)}]() mutable {
+          func(*shared);
+        });
+  }
+
+ private:
+  LocalT local_;
+  std::thread::id owner_ = std::this_thread::get_id();
+  bool transferred_ = false;
+};
+
+template <const auto& class_v_, const auto& class_loader_v_, const auto& jvm_v_>
+HandoffObject(LocalObject<class_v_, class_loader_v_, jvm_v_>&&)
+    -> HandoffObject<class_v_, class_loader_v_, jvm_v_>;
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_HANDOFF_OBJECT_H_
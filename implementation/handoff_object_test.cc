@@ -0,0 +1,141 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Class;
+using ::jni::GlobalObject;
+using ::jni::HandoffObject;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::ThreadGuard;
+using ::jni::test::AsGlobal;
+using ::jni::test::Fake;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::AnyNumber;
+
+static constexpr Class kClass{"kClass",
+                              Method{"Foo", jni::Return{}, Params{}}};
+
+TEST_F(JniTest, HandoffObject_StaysLocalIfNotHandedOff) {
+  // Only the jclass is promoted.
+  EXPECT_CALL(*env_, NewGlobalRef).Times(AnyNumber());
+  EXPECT_CALL(*env_, NewGlobalRef(Fake<jobject>())).Times(0);
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jobject>()))).Times(0);
+  EXPECT_CALL(*env_, CallVoidMethodV(Fake<jobject>(), _, _));
+  EXPECT_CALL(*env_, DeleteLocalRef(_)).Times(AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>()));
+
+  HandoffObject obj{LocalObject<kClass>{Fake<jobject>()}};
+  obj.Local()("Foo");
+}
+
+TEST_F(JniTest, HandoffObject_PromotesOnTransfer) {
+  EXPECT_CALL(*env_, NewGlobalRef(Fake<jobject>()));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>()));
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jobject>())));
+
+  HandoffObject obj{LocalObject<kClass>{Fake<jobject>()}};
+  GlobalObject<kClass> global = std::move(obj).Transfer();
+  EXPECT_EQ(static_cast<jobject>(global), AsGlobal(Fake<jobject>()));
+
+  std::thread worker{[global{std::move(global)}]() mutable {
+    ThreadGuard thread_guard{};
+    EXPECT_EQ(static_cast<jobject>(global), AsGlobal(Fake<jobject>()));
+  }};
+  worker.join();
+}
+
+TEST_F(JniTest, HandoffObject_PostsToExecutorWithAGlobal) {
+  EXPECT_CALL(*env_, NewGlobalRef).Times(AnyNumber());
+  EXPECT_CALL(*env_, NewGlobalRef(Fake<jobject>()));
+  EXPECT_CALL(*env_, DeleteLocalRef).Times(AnyNumber());
+  EXPECT_CALL(*env_, CallVoidMethodV(AsGlobal(Fake<jobject>()), _, _));
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jobject>())));
+
+  std::vector<std::function<void()>> tasks;
+  auto executor = [&tasks](std::function<void()> task) {
+    tasks.push_back(std::move(task));
+  };
+
+  HandoffObject obj{LocalObject<kClass>{Fake<jobject>()}};
+  std::move(obj).Post(executor,
+                      [](GlobalObject<kClass>& global) { global("Foo"); });
+  ASSERT_EQ(tasks.size(), 1);
+
+  std::thread worker{[&tasks] {
+    ThreadGuard thread_guard{};
+    tasks[0]();
+    tasks.clear();
+  }};
+  worker.join();
+}
+
+TEST_F(JniTest, HandoffObject_MovesKeepTheCreatingThread) {
+  EXPECT_CALL(*env_, NewGlobalRef(Fake<jobject>()));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>()));
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jobject>())));
+
+  HandoffObject obj{LocalObject<kClass>{Fake<jobject>()}};
+  HandoffObject moved{std::move(obj)};
+  EXPECT_EQ(static_cast<jobject>(moved.Local()), Fake<jobject>());
+
+  GlobalObject<kClass> global = std::move(moved).Transfer();
+  EXPECT_EQ(static_cast<jobject>(global), AsGlobal(Fake<jobject>()));
+}
+
+#ifndef NDEBUG
+TEST_F(JniTest, HandoffObject_AssertsOnUseAfterHandoff) {
+  EXPECT_DEATH(
+      {
+        HandoffObject obj{LocalObject<kClass>{Fake<jobject>()}};
+        GlobalObject<kClass> global = std::move(obj).Transfer();
+        obj.Local();
+      },
+      "already been handed off");
+
+  EXPECT_DEATH(
+      {
+        HandoffObject obj{LocalObject<kClass>{Fake<jobject>()}};
+        GlobalObject<kClass> global = std::move(obj).Transfer();
+        GlobalObject<kClass> again = std::move(obj).Transfer();
+      },
+      "already been handed off");
+
+  EXPECT_DEATH(
+      {
+        HandoffObject obj{LocalObject<kClass>{Fake<jobject>()}};
+        HandoffObject moved{std::move(obj)};
+        obj.Local();
+      },
+      "already been handed off");
+}
+#endif  // NDEBUG
+
+}  // namespace
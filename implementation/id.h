@@ -225,6 +225,36 @@ struct Id {
   }
 
   static constexpr std::size_t kNumParams = NumParams();
+
+  // True for instance methods whose method or class is marked |Final|.
+  static constexpr bool IsFinal() {
+    if constexpr ((kIdType == IdType::OVERLOAD_SET ||
+                   kIdType == IdType::OVERLOAD ||
+                   kIdType == IdType::OVERLOAD_PARAM) &&
+                  idx != kNoIdx) {
+      return Class().is_final_ || std::get<idx>(Class().methods_).is_final_;
+    } else {
+      return false;
+    }
+  }
+
+  static constexpr bool kIsFinal = IsFinal();
+
+  // True for methods and constructors of a class marked |JValueArgs|.
+  static constexpr bool IsJValueArgs() {
+    if constexpr (kIdType == IdType::OVERLOAD_SET ||
+                  kIdType == IdType::OVERLOAD ||
+                  kIdType == IdType::OVERLOAD_PARAM ||
+                  kIdType == IdType::STATIC_OVERLOAD_SET ||
+                  kIdType == IdType::STATIC_OVERLOAD ||
+                  kIdType == IdType::STATIC_OVERLOAD_PARAM) {
+      return Class().jvalue_args_;
+    } else {
+      return false;
+    }
+  }
+
+  static constexpr bool kIsJValueArgs = IsJValueArgs();
 };
 
 }  // namespace jni
@@ -27,6 +27,7 @@ using ::jni::Class;
 using ::jni::ClassLoader;
 using ::jni::Constructor;
 using ::jni::Field;
+using ::jni::Final;
 using ::jni::Id;
 using ::jni::IdType;
 using ::jni::JniT;
@@ -310,4 +311,32 @@ static_assert(kStaticField1::kRank == 0);
 static_assert(kStaticField2::kRank == 1);
 static_assert(kStaticField3::kRank == 2);
 
+////////////////////////////////////////////////////////////////////////////////
+// Final.
+////////////////////////////////////////////////////////////////////////////////
+static constexpr Class kFinalMethodClass{
+    "kFinalMethodClass",
+    Method{"m0", jni::Return<void>{}, Params{}},
+    Method{"m1", Final{}, jni::Return<void>{}, Params{}},
+};
+
+static constexpr Class kFinalClass{
+    "kFinalClass",
+    Final{},
+    Static{Method{"sm0", jni::Return<void>{}, Params{}}},
+    Method{"m0", jni::Return<void>{}, Params{}},
+};
+
+using JTFM = JniT<jobject, kFinalMethodClass>;
+using JTFC = JniT<jobject, kFinalClass>;
+
+static_assert(!Id<JT, IdType::OVERLOAD, 0, 0>::kIsFinal);
+static_assert(!Id<JTFM, IdType::OVERLOAD, 0, 0>::kIsFinal);
+static_assert(Id<JTFM, IdType::OVERLOAD, 1, 0>::kIsFinal);
+static_assert(Id<JTFC, IdType::OVERLOAD, 0, 0>::kIsFinal);
+
+// Constructors and static methods are never virtually dispatched.
+static_assert(!Id<JTFC, IdType::OVERLOAD, kNoIdx, 0>::kIsFinal);
+static_assert(!Id<JTFC, IdType::STATIC_OVERLOAD, 0, 0>::kIsFinal);
+
 }  // namespace
@@ -0,0 +1,233 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_JNI_HELPER_GLOBAL_REF_DELETION_QUEUE_H_
+#define JNI_BIND_IMPLEMENTATION_JNI_HELPER_GLOBAL_REF_DELETION_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+
+#include "jni_env.h"
+#include "jni_dep.h"
+
+namespace jni {
+
+enum class GlobalDeletionPolicy {
+  // |DeleteGlobalRef| is called by whichever thread releases the reference.
+  kImmediate,
+
+  // References are queued and deleted in batches by |Drain|.
+  kDeferred,
+};
+
+// Process wide queue of global references awaiting deletion.
+//
+// |DeleteGlobalRef| takes the VM's global reference table lock and requires an
+// attached thread.  With |GlobalDeletionPolicy::kDeferred|, destroying a
+// |GlobalObject| (or |GlobalString|, etc.) only pushes the reference onto a
+// lock-free queue, and the actual deletions happen in |Drain|, which is called:
+//
+//   - Explicitly, e.g. periodically on a designated attached thread.
+//   - When the outermost |ThreadGuard| of any thread falls from scope.
+//   - When the |JvmRef| is torn down.
+//
+// This is opt-in (the default is |kImmediate|):
+//
+//   GlobalRefDeletionQueue::SetPolicy(GlobalDeletionPolicy::kDeferred);
+//
+// References are held in a fixed ring of |kCapacity| slots, so enqueueing never
+// allocates.  The trade-off is that a full ring can't absorb a burst: the
+// reference is then deleted immediately (or, on a thread with no JNIEnv, pushed
+// onto an allocated overflow list).  Drain often enough to keep |MaxDepth|
+// below |kCapacity|.
+//
+// References are deleted in no particular order.
+class GlobalRefDeletionQueue {
+ public:
+  static constexpr std::size_t kCapacity = 1024;
+
+  static void SetPolicy(GlobalDeletionPolicy policy) {
+    policy_.store(policy, std::memory_order_relaxed);
+  }
+
+  static GlobalDeletionPolicy GetPolicy() {
+    return policy_.load(std::memory_order_relaxed);
+  }
+
+  // Deletes |object| now, or queues it if deletion is deferred.
+  static void Delete(jobject object) {
+    if (GetPolicy() == GlobalDeletionPolicy::kDeferred) {
+      Enqueue(object);
+    } else {
+      JniEnv::GetEnv()->DeleteGlobalRef(object);
+    }
+  }
+
+  // Queues |object| regardless of policy.  Safe to call from any thread,
+  // including threads which aren't attached to the JVM.
+  static void Enqueue(jobject object) {
+    // Counted before being published so |Drain| can never underflow the depth.
+    const std::size_t depth =
+        depth_.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    if (!TryPush(object)) {
+      if (JNIEnv* env = JniEnv::GetEnv()) {
+        depth_.fetch_sub(1, std::memory_order_relaxed);
+        env->DeleteGlobalRef(object);
+        return;
+      }
+
+      PushOverflow(object);
+    }
+
+    std::size_t max_depth = max_depth_.load(std::memory_order_relaxed);
+    while (depth > max_depth &&
+           !max_depth_.compare_exchange_weak(max_depth, depth,
+                                             std::memory_order_relaxed)) {
+    }
+  }
+
+  // Deletes every queued reference and returns how many were deleted.  Must be
+  // called from an attached thread.
+  //
+  // Concurrent |Drain|s each claim distinct slots, and |Enqueue| is never
+  // blocked.
+  static std::size_t Drain() {
+    std::size_t num_deleted = 0;
+
+    jobject object;
+    while (TryPop(object)) {
+      JniEnv::GetEnv()->DeleteGlobalRef(object);
+      ++num_deleted;
+    }
+
+    Node* node = overflow_.exchange(nullptr, std::memory_order_acquire);
+    while (node) {
+      JniEnv::GetEnv()->DeleteGlobalRef(node->object);
+
+      Node* next = node->next;
+      delete node;
+      node = next;
+      ++num_deleted;
+    }
+
+    depth_.fetch_sub(num_deleted, std::memory_order_relaxed);
+    return num_deleted;
+  }
+
+  // Number of references currently awaiting deletion.
+  static std::size_t Depth() { return depth_.load(std::memory_order_relaxed); }
+
+  // Largest |Depth| observed since the last |ResetMaxDepth|.
+  static std::size_t MaxDepth() {
+    return max_depth_.load(std::memory_order_relaxed);
+  }
+
+  static void ResetMaxDepth() {
+    max_depth_.store(Depth(), std::memory_order_relaxed);
+  }
+
+ private:
+  static_assert((kCapacity & (kCapacity - 1)) == 0,
+                "kCapacity must be a power of two.");
+
+  // Bounded MPMC ring (after Vyukov).  Slot |i| is ready to be written at
+  // position |pos| when its sequence is |pos|, and to be read when it is
+  // |pos + 1|.  Sequences are stored relative to the slot's index so that the
+  // zero initialised ring is empty, with no static initialisation order issues.
+  struct Slot {
+    std::atomic<std::size_t> sequence;
+    jobject object;
+  };
+
+  struct Node {
+    jobject object;
+    Node* next;
+  };
+
+  static std::size_t LoadSequence(std::size_t idx) {
+    return slots_[idx].sequence.load(std::memory_order_acquire) + idx;
+  }
+
+  static void StoreSequence(std::size_t idx, std::size_t sequence) {
+    slots_[idx].sequence.store(sequence - idx, std::memory_order_release);
+  }
+
+  // Returns false if the ring is full.
+  static bool TryPush(jobject object) {
+    std::size_t pos = push_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      const std::size_t idx = pos & (kCapacity - 1);
+      const auto diff = static_cast<std::ptrdiff_t>(LoadSequence(idx) - pos);
+      if (diff == 0) {
+        if (push_pos_.compare_exchange_weak(pos, pos + 1,
+                                            std::memory_order_relaxed)) {
+          slots_[idx].object = object;
+          StoreSequence(idx, pos + 1);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = push_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Returns false if the ring is empty.
+  static bool TryPop(jobject& object) {
+    std::size_t pos = pop_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      const std::size_t idx = pos & (kCapacity - 1);
+      const auto diff =
+          static_cast<std::ptrdiff_t>(LoadSequence(idx) - (pos + 1));
+      if (diff == 0) {
+        if (pop_pos_.compare_exchange_weak(pos, pos + 1,
+                                           std::memory_order_relaxed)) {
+          object = slots_[idx].object;
+          StoreSequence(idx, pos + kCapacity);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = pop_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Only used when the ring is full on a thread with no JNIEnv.
+  static void PushOverflow(jobject object) {
+    Node* node = new Node{object, overflow_.load(std::memory_order_relaxed)};
+    while (!overflow_.compare_exchange_weak(node->next, node,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+    }
+  }
+
+  static inline std::atomic<GlobalDeletionPolicy> policy_{
+      GlobalDeletionPolicy::kImmediate};
+  static inline Slot slots_[kCapacity] = {};
+  static inline std::atomic<std::size_t> push_pos_{0};
+  static inline std::atomic<std::size_t> pop_pos_{0};
+  static inline std::atomic<Node*> overflow_{nullptr};
+  static inline std::atomic<std::size_t> depth_{0};
+  static inline std::atomic<std::size_t> max_depth_{0};
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_JNI_HELPER_GLOBAL_REF_DELETION_QUEUE_H_
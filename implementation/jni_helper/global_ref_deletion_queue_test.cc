@@ -0,0 +1,171 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "implementation/jni_helper/global_ref_deletion_queue.h"
+
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::AdoptGlobal;
+using ::jni::Class;
+using ::jni::GlobalDeletionPolicy;
+using ::jni::GlobalObject;
+using ::jni::GlobalRefDeletionQueue;
+using ::jni::GlobalString;
+using ::jni::ThreadGuard;
+using ::jni::test::Fake;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::AnyNumber;
+
+static constexpr Class kClass{"kClass"};
+
+// Restores immediate deletion so the fixture's teardown is unaffected.
+class JniTestWithDeferredDeletion : public JniTest {
+ protected:
+  void SetUp() override {
+    JniTest::SetUp();
+    GlobalRefDeletionQueue::SetPolicy(GlobalDeletionPolicy::kDeferred);
+    GlobalRefDeletionQueue::ResetMaxDepth();
+  }
+
+  void TearDown() override {
+    GlobalRefDeletionQueue::SetPolicy(GlobalDeletionPolicy::kImmediate);
+    GlobalRefDeletionQueue::Drain();
+    JniTest::TearDown();
+  }
+};
+
+TEST_F(JniTest, GlobalRefDeletionQueue_DeletesImmediatelyByDefault) {
+  EXPECT_CALL(*env_, DeleteGlobalRef(Fake<jobject>()));
+
+  { GlobalObject<kClass> obj{AdoptGlobal{}, Fake<jobject>()}; }
+  EXPECT_EQ(GlobalRefDeletionQueue::Depth(), 0);
+}
+
+TEST_F(JniTestWithDeferredDeletion, GlobalRefDeletionQueue_DefersUntilDrain) {
+  ::testing::MockFunction<void()> drain;
+  {
+    ::testing::InSequence seq;
+    EXPECT_CALL(drain, Call);
+    EXPECT_CALL(*env_, DeleteGlobalRef(_)).Times(2);
+  }
+
+  {
+    GlobalObject<kClass> obj{AdoptGlobal{}, Fake<jobject>(1)};
+    GlobalString str{AdoptGlobal{}, Fake<jstring>(2)};
+  }
+  EXPECT_EQ(GlobalRefDeletionQueue::Depth(), 2);
+  EXPECT_EQ(GlobalRefDeletionQueue::MaxDepth(), 2);
+
+  drain.Call();
+  EXPECT_EQ(GlobalRefDeletionQueue::Drain(), 2);
+  EXPECT_EQ(GlobalRefDeletionQueue::Depth(), 0);
+  EXPECT_EQ(GlobalRefDeletionQueue::MaxDepth(), 2);
+}
+
+TEST_F(JniTestWithDeferredDeletion,
+       GlobalRefDeletionQueue_EnqueuesFromManyThreads) {
+  EXPECT_CALL(*env_, DeleteGlobalRef(Fake<jobject>())).Times(400);
+
+  // No |ThreadGuard| is needed to enqueue.
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([] {
+      for (int j = 0; j < 100; ++j) {
+        GlobalObject<kClass> obj{AdoptGlobal{}, Fake<jobject>()};
+      }
+    });
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(GlobalRefDeletionQueue::Depth(), 400);
+  EXPECT_EQ(GlobalRefDeletionQueue::Drain(), 400);
+}
+
+TEST_F(JniTestWithDeferredDeletion,
+       GlobalRefDeletionQueue_DrainsWhenOutermostThreadGuardExits) {
+  EXPECT_CALL(*jvm_, GetEnv).Times(AnyNumber());
+  EXPECT_CALL(*env_, DeleteGlobalRef(Fake<jobject>()));
+
+  std::thread worker{[] {
+    ThreadGuard outer{};
+    {
+      ThreadGuard inner{};
+      GlobalObject<kClass> obj{AdoptGlobal{}, Fake<jobject>()};
+    }
+    EXPECT_EQ(GlobalRefDeletionQueue::Depth(), 1);
+  }};
+  worker.join();
+
+  EXPECT_EQ(GlobalRefDeletionQueue::Depth(), 0);
+}
+
+TEST_F(JniTestWithDeferredDeletion,
+       GlobalRefDeletionQueue_DeletesImmediatelyWhenFull) {
+  constexpr std::size_t kCapacity = GlobalRefDeletionQueue::kCapacity;
+
+  ::testing::MockFunction<void()> drain;
+  {
+    ::testing::InSequence seq;
+    EXPECT_CALL(*env_, DeleteGlobalRef(Fake<jobject>(2))).Times(2);
+    EXPECT_CALL(drain, Call);
+    EXPECT_CALL(*env_, DeleteGlobalRef(Fake<jobject>(1))).Times(kCapacity);
+  }
+
+  for (std::size_t i = 0; i < kCapacity; ++i) {
+    GlobalRefDeletionQueue::Enqueue(Fake<jobject>(1));
+  }
+  GlobalRefDeletionQueue::Enqueue(Fake<jobject>(2));
+  GlobalRefDeletionQueue::Enqueue(Fake<jobject>(2));
+  EXPECT_EQ(GlobalRefDeletionQueue::Depth(), kCapacity);
+
+  drain.Call();
+  EXPECT_EQ(GlobalRefDeletionQueue::Drain(), kCapacity);
+}
+
+TEST_F(JniTestWithDeferredDeletion,
+       GlobalRefDeletionQueue_OverflowsWhenFullOnAnUnattachedThread) {
+  constexpr std::size_t kCapacity = GlobalRefDeletionQueue::kCapacity;
+
+  EXPECT_CALL(*env_, DeleteGlobalRef(Fake<jobject>(1))).Times(kCapacity);
+  EXPECT_CALL(*env_, DeleteGlobalRef(Fake<jobject>(2)));
+
+  std::thread worker{[] {
+    for (std::size_t i = 0; i < kCapacity; ++i) {
+      GlobalRefDeletionQueue::Enqueue(Fake<jobject>(1));
+    }
+    GlobalRefDeletionQueue::Enqueue(Fake<jobject>(2));
+  }};
+  worker.join();
+
+  EXPECT_EQ(GlobalRefDeletionQueue::Depth(), kCapacity + 1);
+  EXPECT_EQ(GlobalRefDeletionQueue::Drain(), kCapacity + 1);
+  EXPECT_EQ(GlobalRefDeletionQueue::Depth(), 0);
+}
+
+}  // namespace
@@ -38,6 +38,24 @@ struct InvokeHelper<void, 0, false> {
     jni::JniEnv::GetEnv()->CallVoidMethod(object, method_id,
                                           std::forward<Ts>(ts)...);
   }
+
+  static void InvokeA(jobject object, jclass, jmethodID method_id,
+                      const jvalue* args) {
+    jni::JniEnv::GetEnv()->CallVoidMethodA(object, method_id, args);
+  }
+
+  template <typename... Ts>
+  static void InvokeNonvirtual(jobject object, jclass clazz,
+                               jmethodID method_id, Ts&&... ts) {
+    jni::JniEnv::GetEnv()->CallNonvirtualVoidMethod(object, clazz, method_id,
+                                                    std::forward<Ts>(ts)...);
+  }
+
+  static void InvokeNonvirtualA(jobject object, jclass clazz,
+                                jmethodID method_id, const jvalue* args) {
+    jni::JniEnv::GetEnv()->CallNonvirtualVoidMethodA(object, clazz, method_id,
+                                                     args);
+  }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -51,6 +69,24 @@ struct InvokeHelper<jboolean, 0, false> {
     return jni::JniEnv::GetEnv()->CallBooleanMethod(object, method_id,
                                                     std::forward<Ts>(ts)...);
   }
+
+  static jboolean InvokeA(jobject object, jclass, jmethodID method_id,
+                          const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallBooleanMethodA(object, method_id, args);
+  }
+
+  template <typename... Ts>
+  static jboolean InvokeNonvirtual(jobject object, jclass clazz,
+                                   jmethodID method_id, Ts&&... ts) {
+    return jni::JniEnv::GetEnv()->CallNonvirtualBooleanMethod(
+        object, clazz, method_id, std::forward<Ts>(ts)...);
+  }
+
+  static jboolean InvokeNonvirtualA(jobject object, jclass clazz,
+                                    jmethodID method_id, const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallNonvirtualBooleanMethodA(object, clazz,
+                                                               method_id, args);
+  }
 };
 
 template <>
@@ -60,6 +96,24 @@ struct InvokeHelper<jint, 0, false> {
     return jni::JniEnv::GetEnv()->CallIntMethod(object, method_id,
                                                 std::forward<Ts>(ts)...);
   }
+
+  static jint InvokeA(jobject object, jclass, jmethodID method_id,
+                      const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallIntMethodA(object, method_id, args);
+  }
+
+  template <typename... Ts>
+  static jint InvokeNonvirtual(jobject object, jclass clazz,
+                               jmethodID method_id, Ts&&... ts) {
+    return jni::JniEnv::GetEnv()->CallNonvirtualIntMethod(
+        object, clazz, method_id, std::forward<Ts>(ts)...);
+  }
+
+  static jint InvokeNonvirtualA(jobject object, jclass clazz,
+                                jmethodID method_id, const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallNonvirtualIntMethodA(object, clazz,
+                                                           method_id, args);
+  }
 };
 
 template <>
@@ -69,6 +123,24 @@ struct InvokeHelper<jlong, 0, false> {
     return jni::JniEnv::GetEnv()->CallLongMethod(object, method_id,
                                                  std::forward<Ts>(ts)...);
   }
+
+  static jlong InvokeA(jobject object, jclass, jmethodID method_id,
+                       const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallLongMethodA(object, method_id, args);
+  }
+
+  template <typename... Ts>
+  static jlong InvokeNonvirtual(jobject object, jclass clazz,
+                                jmethodID method_id, Ts&&... ts) {
+    return jni::JniEnv::GetEnv()->CallNonvirtualLongMethod(
+        object, clazz, method_id, std::forward<Ts>(ts)...);
+  }
+
+  static jlong InvokeNonvirtualA(jobject object, jclass clazz,
+                                 jmethodID method_id, const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallNonvirtualLongMethodA(object, clazz,
+                                                            method_id, args);
+  }
 };
 
 template <>
@@ -79,6 +151,24 @@ struct InvokeHelper<jfloat, 0, false> {
     return jni::JniEnv::GetEnv()->CallFloatMethod(object, method_id,
                                                   std::forward<Ts>(ts)...);
   }
+
+  static jfloat InvokeA(jobject object, jclass, jmethodID method_id,
+                        const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallFloatMethodA(object, method_id, args);
+  }
+
+  template <typename... Ts>
+  static jfloat InvokeNonvirtual(jobject object, jclass clazz,
+                                 jmethodID method_id, Ts&&... ts) {
+    return jni::JniEnv::GetEnv()->CallNonvirtualFloatMethod(
+        object, clazz, method_id, std::forward<Ts>(ts)...);
+  }
+
+  static jfloat InvokeNonvirtualA(jobject object, jclass clazz,
+                                  jmethodID method_id, const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallNonvirtualFloatMethodA(object, clazz,
+                                                             method_id, args);
+  }
 };
 
 template <>
@@ -89,6 +179,24 @@ struct InvokeHelper<jdouble, 0, false> {
     return jni::JniEnv::GetEnv()->CallDoubleMethod(object, method_id,
                                                    std::forward<Ts>(ts)...);
   }
+
+  static jdouble InvokeA(jobject object, jclass, jmethodID method_id,
+                         const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallDoubleMethodA(object, method_id, args);
+  }
+
+  template <typename... Ts>
+  static jdouble InvokeNonvirtual(jobject object, jclass clazz,
+                                  jmethodID method_id, Ts&&... ts) {
+    return jni::JniEnv::GetEnv()->CallNonvirtualDoubleMethod(
+        object, clazz, method_id, std::forward<Ts>(ts)...);
+  }
+
+  static jdouble InvokeNonvirtualA(jobject object, jclass clazz,
+                                   jmethodID method_id, const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallNonvirtualDoubleMethodA(object, clazz,
+                                                              method_id, args);
+  }
 };
 
 template <>
@@ -101,6 +209,24 @@ struct InvokeHelper<jobject, 0, false> {
     return jni::JniEnv::GetEnv()->CallObjectMethod(object, method_id,
                                                    std::forward<Ts>(ts)...);
   }
+
+  static jobject InvokeA(jobject object, jclass, jmethodID method_id,
+                         const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args);
+  }
+
+  template <typename... Ts>
+  static jobject InvokeNonvirtual(jobject object, jclass clazz,
+                                  jmethodID method_id, Ts&&... ts) {
+    return jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+        object, clazz, method_id, std::forward<Ts>(ts)...);
+  }
+
+  static jobject InvokeNonvirtualA(jobject object, jclass clazz,
+                                   jmethodID method_id, const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                              method_id, args);
+  }
 };
 
 template <>
@@ -111,6 +237,24 @@ struct InvokeHelper<jstring, 0, false> {
     return jni::JniEnv::GetEnv()->CallObjectMethod(object, method_id,
                                                    std::forward<Ts>(ts)...);
   }
+
+  static jobject InvokeA(jobject object, jclass, jmethodID method_id,
+                         const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args);
+  }
+
+  template <typename... Ts>
+  static jobject InvokeNonvirtual(jobject object, jclass clazz,
+                                  jmethodID method_id, Ts&&... ts) {
+    return jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+        object, clazz, method_id, std::forward<Ts>(ts)...);
+  }
+
+  static jobject InvokeNonvirtualA(jobject object, jclass clazz,
+                                   jmethodID method_id, const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                              method_id, args);
+  }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -124,6 +268,28 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jboolean>, kRank, false> {
     return static_cast<jbooleanArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jbooleanArray InvokeA(jobject object, jclass, jmethodID method_id,
+                               const jvalue* args) {
+    return static_cast<jbooleanArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jbooleanArray InvokeNonvirtual(jobject object, jclass clazz,
+                                        jmethodID method_id, Ts&&... ts) {
+    return static_cast<jbooleanArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jbooleanArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                         jmethodID method_id,
+                                         const jvalue* args) {
+    return static_cast<jbooleanArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -134,6 +300,27 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jbyte>, kRank, false> {
     return static_cast<jbyteArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jbyteArray InvokeA(jobject object, jclass, jmethodID method_id,
+                            const jvalue* args) {
+    return static_cast<jbyteArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jbyteArray InvokeNonvirtual(jobject object, jclass clazz,
+                                     jmethodID method_id, Ts&&... ts) {
+    return static_cast<jbyteArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jbyteArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                      jmethodID method_id, const jvalue* args) {
+    return static_cast<jbyteArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -144,6 +331,27 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jchar>, kRank, false> {
     return static_cast<jcharArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jcharArray InvokeA(jobject object, jclass, jmethodID method_id,
+                            const jvalue* args) {
+    return static_cast<jcharArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jcharArray InvokeNonvirtual(jobject object, jclass clazz,
+                                     jmethodID method_id, Ts&&... ts) {
+    return static_cast<jcharArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jcharArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                      jmethodID method_id, const jvalue* args) {
+    return static_cast<jcharArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -154,6 +362,28 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jshort>, kRank, false> {
     return static_cast<jshortArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jshortArray InvokeA(jobject object, jclass, jmethodID method_id,
+                             const jvalue* args) {
+    return static_cast<jshortArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jshortArray InvokeNonvirtual(jobject object, jclass clazz,
+                                      jmethodID method_id, Ts&&... ts) {
+    return static_cast<jshortArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jshortArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                       jmethodID method_id,
+                                       const jvalue* args) {
+    return static_cast<jshortArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -164,6 +394,27 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jint>, kRank, false> {
     return static_cast<jintArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jintArray InvokeA(jobject object, jclass, jmethodID method_id,
+                           const jvalue* args) {
+    return static_cast<jintArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jintArray InvokeNonvirtual(jobject object, jclass clazz,
+                                    jmethodID method_id, Ts&&... ts) {
+    return static_cast<jintArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jintArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                     jmethodID method_id, const jvalue* args) {
+    return static_cast<jintArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -174,6 +425,27 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jlong>, kRank, false> {
     return static_cast<jlongArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jlongArray InvokeA(jobject object, jclass, jmethodID method_id,
+                            const jvalue* args) {
+    return static_cast<jlongArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jlongArray InvokeNonvirtual(jobject object, jclass clazz,
+                                     jmethodID method_id, Ts&&... ts) {
+    return static_cast<jlongArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jlongArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                      jmethodID method_id, const jvalue* args) {
+    return static_cast<jlongArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -184,6 +456,28 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jfloat>, kRank, false> {
     return static_cast<jfloatArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jfloatArray InvokeA(jobject object, jclass, jmethodID method_id,
+                             const jvalue* args) {
+    return static_cast<jfloatArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jfloatArray InvokeNonvirtual(jobject object, jclass clazz,
+                                      jmethodID method_id, Ts&&... ts) {
+    return static_cast<jfloatArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jfloatArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                       jmethodID method_id,
+                                       const jvalue* args) {
+    return static_cast<jfloatArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -194,6 +488,28 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jdouble>, kRank, false> {
     return static_cast<jdoubleArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jdoubleArray InvokeA(jobject object, jclass, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jdoubleArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jdoubleArray InvokeNonvirtual(jobject object, jclass clazz,
+                                       jmethodID method_id, Ts&&... ts) {
+    return static_cast<jdoubleArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jdoubleArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                        jmethodID method_id,
+                                        const jvalue* args) {
+    return static_cast<jdoubleArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -206,6 +522,28 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jarray>, kRank, false> {
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject object, jclass, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jobjectArray InvokeNonvirtual(jobject object, jclass clazz,
+                                       jmethodID method_id, Ts&&... ts) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jobjectArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                        jmethodID method_id,
+                                        const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -216,6 +554,28 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jobject>, kRank, false> {
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject object, jclass, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jobjectArray InvokeNonvirtual(jobject object, jclass clazz,
+                                       jmethodID method_id, Ts&&... ts) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jobjectArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                        jmethodID method_id,
+                                        const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -229,6 +589,28 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jboolean>, kRank, false> {
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject object, jclass, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jobjectArray InvokeNonvirtual(jobject object, jclass clazz,
+                                       jmethodID method_id, Ts&&... ts) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jobjectArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                        jmethodID method_id,
+                                        const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -239,6 +621,28 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jbyte>, kRank, false> {
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject object, jclass, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jobjectArray InvokeNonvirtual(jobject object, jclass clazz,
+                                       jmethodID method_id, Ts&&... ts) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jobjectArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                        jmethodID method_id,
+                                        const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -249,6 +653,28 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jchar>, kRank, false> {
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject object, jclass, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jobjectArray InvokeNonvirtual(jobject object, jclass clazz,
+                                       jmethodID method_id, Ts&&... ts) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jobjectArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                        jmethodID method_id,
+                                        const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -259,6 +685,28 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jshort>, kRank, false> {
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject object, jclass, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jobjectArray InvokeNonvirtual(jobject object, jclass clazz,
+                                       jmethodID method_id, Ts&&... ts) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jobjectArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                        jmethodID method_id,
+                                        const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -269,6 +717,28 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jint>, kRank, false> {
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject object, jclass, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jobjectArray InvokeNonvirtual(jobject object, jclass clazz,
+                                       jmethodID method_id, Ts&&... ts) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jobjectArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                        jmethodID method_id,
+                                        const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -279,6 +749,28 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jfloat>, kRank, false> {
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject object, jclass, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jobjectArray InvokeNonvirtual(jobject object, jclass clazz,
+                                       jmethodID method_id, Ts&&... ts) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jobjectArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                        jmethodID method_id,
+                                        const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -289,6 +781,28 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jdouble>, kRank, false> {
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject object, jclass, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jobjectArray InvokeNonvirtual(jobject object, jclass clazz,
+                                       jmethodID method_id, Ts&&... ts) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jobjectArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                        jmethodID method_id,
+                                        const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -299,6 +813,28 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jlong>, kRank, false> {
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject object, jclass, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jobjectArray InvokeNonvirtual(jobject object, jclass clazz,
+                                       jmethodID method_id, Ts&&... ts) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jobjectArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                        jmethodID method_id,
+                                        const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -311,6 +847,28 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jarray>, kRank, false> {
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject object, jclass, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jobjectArray InvokeNonvirtual(jobject object, jclass clazz,
+                                       jmethodID method_id, Ts&&... ts) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jobjectArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                        jmethodID method_id,
+                                        const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 template <std::size_t kRank>
@@ -321,6 +879,28 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jobject>, kRank, false> {
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject object, jclass, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args));
+  }
+
+  template <typename... Ts>
+  static jobjectArray InvokeNonvirtual(jobject object, jclass clazz,
+                                       jmethodID method_id, Ts&&... ts) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+  }
+
+  static jobjectArray InvokeNonvirtualA(jobject object, jclass clazz,
+                                        jmethodID method_id,
+                                        const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+  }
 };
 
 }  // namespace jni
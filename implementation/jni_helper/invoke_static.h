@@ -35,6 +35,11 @@ struct InvokeHelper<void, 0, true> {
     jni::JniEnv::GetEnv()->CallStaticVoidMethod(clazz, method_id,
                                                 std::forward<Ts>(ts)...);
   }
+
+  static void InvokeA(jobject, jclass clazz, jmethodID method_id,
+                      const jvalue* args) {
+    jni::JniEnv::GetEnv()->CallStaticVoidMethodA(clazz, method_id, args);
+  }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -48,36 +53,55 @@ struct InvokeHelper<jboolean, 0, true> {
     return jni::JniEnv::GetEnv()->CallStaticBooleanMethod(
         clazz, method_id, std::forward<Ts>(ts)...);
   }
+
+  static jboolean InvokeA(jobject, jclass clazz, jmethodID method_id,
+                          const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallStaticBooleanMethodA(clazz, method_id,
+                                                           args);
+  }
 };
 
 template <>
 struct InvokeHelper<jbyte, 0, true> {
   template <typename... Ts>
-  static jboolean Invoke(jobject, jclass clazz, jmethodID method_id,
-                         Ts&&... ts) {
+  static jbyte Invoke(jobject, jclass clazz, jmethodID method_id, Ts&&... ts) {
     return jni::JniEnv::GetEnv()->CallStaticByteMethod(clazz, method_id,
                                                        std::forward<Ts>(ts)...);
   }
+
+  static jbyte InvokeA(jobject, jclass clazz, jmethodID method_id,
+                       const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallStaticByteMethodA(clazz, method_id, args);
+  }
 };
 
 template <>
 struct InvokeHelper<jchar, 0, true> {
   template <typename... Ts>
-  static jboolean Invoke(jobject, jclass clazz, jmethodID method_id,
-                         Ts&&... ts) {
+  static jchar Invoke(jobject, jclass clazz, jmethodID method_id, Ts&&... ts) {
     return jni::JniEnv::GetEnv()->CallStaticCharMethod(clazz, method_id,
                                                        std::forward<Ts>(ts)...);
   }
+
+  static jchar InvokeA(jobject, jclass clazz, jmethodID method_id,
+                       const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallStaticCharMethodA(clazz, method_id, args);
+  }
 };
 
 template <>
 struct InvokeHelper<jshort, 0, true> {
   template <typename... Ts>
-  static jboolean Invoke(jobject, jclass clazz, jmethodID method_id,
-                         Ts&&... ts) {
+  static jshort Invoke(jobject, jclass clazz, jmethodID method_id, Ts&&... ts) {
     return jni::JniEnv::GetEnv()->CallStaticShortMethod(
         clazz, method_id, std::forward<Ts>(ts)...);
   }
+
+  static jshort InvokeA(jobject, jclass clazz, jmethodID method_id,
+                        const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallStaticShortMethodA(clazz, method_id,
+                                                         args);
+  }
 };
 
 template <>
@@ -87,6 +111,11 @@ struct InvokeHelper<jint, 0, true> {
     return jni::JniEnv::GetEnv()->CallStaticIntMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...);
   }
+
+  static jint InvokeA(jobject, jclass clazz, jmethodID method_id,
+                      const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallStaticIntMethodA(clazz, method_id, args);
+  }
 };
 
 template <>
@@ -96,6 +125,11 @@ struct InvokeHelper<jlong, 0, true> {
     return jni::JniEnv::GetEnv()->CallStaticLongMethod(clazz, method_id,
                                                        std::forward<Ts>(ts)...);
   }
+
+  static jlong InvokeA(jobject, jclass clazz, jmethodID method_id,
+                       const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallStaticLongMethodA(clazz, method_id, args);
+  }
 };
 
 template <>
@@ -105,6 +139,12 @@ struct InvokeHelper<jfloat, 0, true> {
     return jni::JniEnv::GetEnv()->CallStaticFloatMethod(
         clazz, method_id, std::forward<Ts>(ts)...);
   }
+
+  static jfloat InvokeA(jobject, jclass clazz, jmethodID method_id,
+                        const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallStaticFloatMethodA(clazz, method_id,
+                                                         args);
+  }
 };
 
 template <>
@@ -115,6 +155,12 @@ struct InvokeHelper<jdouble, 0, true> {
     return jni::JniEnv::GetEnv()->CallStaticDoubleMethod(
         clazz, method_id, std::forward<Ts>(ts)...);
   }
+
+  static jdouble InvokeA(jobject, jclass clazz, jmethodID method_id,
+                         const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallStaticDoubleMethodA(clazz, method_id,
+                                                          args);
+  }
 };
 
 template <>
@@ -127,6 +173,12 @@ struct InvokeHelper<jobject, 0, true> {
     return jni::JniEnv::GetEnv()->CallStaticObjectMethod(
         clazz, method_id, std::forward<Ts>(ts)...);
   }
+
+  static jobject InvokeA(jobject, jclass clazz, jmethodID method_id,
+                         const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                          args);
+  }
 };
 
 template <>
@@ -137,6 +189,12 @@ struct InvokeHelper<jstring, 0, true> {
     return jni::JniEnv::GetEnv()->CallStaticObjectMethod(
         clazz, method_id, std::forward<Ts>(ts)...);
   }
+
+  static jobject InvokeA(jobject, jclass clazz, jmethodID method_id,
+                         const jvalue* args) {
+    return jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                          args);
+  }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -151,6 +209,13 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jboolean>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jbooleanArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                               const jvalue* args) {
+    return static_cast<jbooleanArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -162,6 +227,13 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jbyte>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jbyteArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                            const jvalue* args) {
+    return static_cast<jbyteArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -173,6 +245,13 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jchar>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jcharArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                            const jvalue* args) {
+    return static_cast<jcharArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -184,6 +263,13 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jshort>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jshortArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                             const jvalue* args) {
+    return static_cast<jshortArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -194,6 +280,13 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jint>, kRank, true> {
     return static_cast<jintArray>(jni::JniEnv::GetEnv()->CallStaticObjectMethod(
         clazz, method_id, std::forward<Ts>(ts)...));
   }
+
+  static jintArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                           const jvalue* args) {
+    return static_cast<jintArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -205,6 +298,13 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jfloat>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jfloatArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                             const jvalue* args) {
+    return static_cast<jfloatArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -216,6 +316,13 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jdouble>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jdoubleArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jdoubleArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -227,6 +334,13 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jlong>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jlongArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                            const jvalue* args) {
+    return static_cast<jlongArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -240,6 +354,13 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jarray>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -251,6 +372,13 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jobject>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -265,6 +393,13 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jboolean>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -276,6 +411,13 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jbyte>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -287,6 +429,13 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jchar>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -298,6 +447,13 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jshort>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -309,6 +465,13 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jint>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -320,6 +483,13 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jfloat>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -331,6 +501,13 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jdouble>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -342,6 +519,13 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jlong>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -355,6 +539,13 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jarray>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 template <std::size_t kRank>
@@ -366,6 +557,13 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jobject>, kRank, true> {
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
   }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                       args));
+  }
 };
 
 }  // namespace jni
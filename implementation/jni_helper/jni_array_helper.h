@@ -27,13 +27,31 @@ namespace jni {
 template <typename SpanType>
 struct GetArrayElementsResult {
   SpanType* ptr_;
-  jboolean is_copy;
+
+  // Conservatively assumes a copy if the VM doesn't report otherwise.
+  jboolean is_copy = JNI_TRUE;
 };
 
 struct JniArrayHelperBase {
   static inline std::size_t GetLength(jarray array) {
     return jni::JniEnv::GetEnv()->GetArrayLength(array);
   }
+
+  // No other JNI calls may be made until |ReleasePrimitiveArrayCritical|.
+  static inline GetArrayElementsResult<void> GetPrimitiveArrayCritical(
+      jarray array) {
+    GetArrayElementsResult<void> return_value;
+    return_value.ptr_ = jni::JniEnv::GetEnv()->GetPrimitiveArrayCritical(
+        array, &return_value.is_copy);
+    return return_value;
+  }
+
+  static inline void ReleasePrimitiveArrayCritical(jarray array,
+                                                   void* native_ptr,
+                                                   jint release_mode) {
+    jni::JniEnv::GetEnv()->ReleasePrimitiveArrayCritical(array, native_ptr,
+                                                         release_mode);
+  }
 };
 
 // Rank 2+ arrays all behave like object arrays.
@@ -77,10 +95,22 @@ struct JniArrayHelper<jboolean, 1> : public JniArrayHelperBase {
   }
 
   static inline void ReleaseArrayElements(jarray array, jboolean* native_ptr,
-                                          bool copy_on_completion) {
-    const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
+                                          jint release_mode) {
     jni::JniEnv::GetEnv()->ReleaseBooleanArrayElements(
-        static_cast<jbooleanArray>(array), native_ptr, copy_back_mode);
+        static_cast<jbooleanArray>(array), native_ptr, release_mode);
+  }
+
+  // Copies |len| elements starting at |start| without pinning the array.
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jboolean* buf) {
+    jni::JniEnv::GetEnv()->GetBooleanArrayRegion(
+        static_cast<jbooleanArray>(array), start, len, buf);
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jboolean* buf) {
+    jni::JniEnv::GetEnv()->SetBooleanArrayRegion(
+        static_cast<jbooleanArray>(array), start, len, buf);
   }
 };
 
@@ -100,10 +130,22 @@ struct JniArrayHelper<jbyte, 1> : public JniArrayHelperBase {
   }
 
   static inline void ReleaseArrayElements(jarray array, jbyte* native_ptr,
-                                          bool copy_on_completion) {
-    const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
+                                          jint release_mode) {
     jni::JniEnv::GetEnv()->ReleaseByteArrayElements(
-        static_cast<jbyteArray>(array), native_ptr, copy_back_mode);
+        static_cast<jbyteArray>(array), native_ptr, release_mode);
+  }
+
+  // Copies |len| elements starting at |start| without pinning the array.
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jbyte* buf) {
+    jni::JniEnv::GetEnv()->GetByteArrayRegion(
+        static_cast<jbyteArray>(array), start, len, buf);
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jbyte* buf) {
+    jni::JniEnv::GetEnv()->SetByteArrayRegion(
+        static_cast<jbyteArray>(array), start, len, buf);
   }
 };
 
@@ -123,10 +165,22 @@ struct JniArrayHelper<jchar, 1> : public JniArrayHelperBase {
   }
 
   static inline void ReleaseArrayElements(jarray array, jchar* native_ptr,
-                                          bool copy_on_completion) {
-    const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
+                                          jint release_mode) {
     jni::JniEnv::GetEnv()->ReleaseCharArrayElements(
-        static_cast<jcharArray>(array), native_ptr, copy_back_mode);
+        static_cast<jcharArray>(array), native_ptr, release_mode);
+  }
+
+  // Copies |len| elements starting at |start| without pinning the array.
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jchar* buf) {
+    jni::JniEnv::GetEnv()->GetCharArrayRegion(
+        static_cast<jcharArray>(array), start, len, buf);
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jchar* buf) {
+    jni::JniEnv::GetEnv()->SetCharArrayRegion(
+        static_cast<jcharArray>(array), start, len, buf);
   }
 };
 
@@ -146,10 +200,22 @@ struct JniArrayHelper<jshort, 1> : public JniArrayHelperBase {
   }
 
   static inline void ReleaseArrayElements(jarray array, jshort* native_ptr,
-                                          bool copy_on_completion) {
-    const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
+                                          jint release_mode) {
     jni::JniEnv::GetEnv()->ReleaseShortArrayElements(
-        static_cast<jshortArray>(array), native_ptr, copy_back_mode);
+        static_cast<jshortArray>(array), native_ptr, release_mode);
+  }
+
+  // Copies |len| elements starting at |start| without pinning the array.
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jshort* buf) {
+    jni::JniEnv::GetEnv()->GetShortArrayRegion(
+        static_cast<jshortArray>(array), start, len, buf);
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jshort* buf) {
+    jni::JniEnv::GetEnv()->SetShortArrayRegion(
+        static_cast<jshortArray>(array), start, len, buf);
   }
 };
 
@@ -169,10 +235,22 @@ struct JniArrayHelper<jint, 1> : public JniArrayHelperBase {
   }
 
   static inline void ReleaseArrayElements(jarray array, int* native_ptr,
-                                          bool copy_on_completion) {
-    const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
+                                          jint release_mode) {
     jni::JniEnv::GetEnv()->ReleaseIntArrayElements(
-        static_cast<jintArray>(array), native_ptr, copy_back_mode);
+        static_cast<jintArray>(array), native_ptr, release_mode);
+  }
+
+  // Copies |len| elements starting at |start| without pinning the array.
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jint* buf) {
+    jni::JniEnv::GetEnv()->GetIntArrayRegion(
+        static_cast<jintArray>(array), start, len, buf);
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jint* buf) {
+    jni::JniEnv::GetEnv()->SetIntArrayRegion(
+        static_cast<jintArray>(array), start, len, buf);
   }
 };
 
@@ -192,10 +270,22 @@ struct JniArrayHelper<jlong, 1> : public JniArrayHelperBase {
   }
 
   static inline void ReleaseArrayElements(jarray array, jlong* native_ptr,
-                                          bool copy_on_completion) {
-    const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
+                                          jint release_mode) {
     jni::JniEnv::GetEnv()->ReleaseLongArrayElements(
-        static_cast<jlongArray>(array), native_ptr, copy_back_mode);
+        static_cast<jlongArray>(array), native_ptr, release_mode);
+  }
+
+  // Copies |len| elements starting at |start| without pinning the array.
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jlong* buf) {
+    jni::JniEnv::GetEnv()->GetLongArrayRegion(
+        static_cast<jlongArray>(array), start, len, buf);
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jlong* buf) {
+    jni::JniEnv::GetEnv()->SetLongArrayRegion(
+        static_cast<jlongArray>(array), start, len, buf);
   }
 };
 
@@ -215,10 +305,22 @@ struct JniArrayHelper<jfloat, 1> : public JniArrayHelperBase {
   }
 
   static inline void ReleaseArrayElements(jarray array, jfloat* native_ptr,
-                                          bool copy_on_completion) {
-    const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
+                                          jint release_mode) {
     jni::JniEnv::GetEnv()->ReleaseFloatArrayElements(
-        static_cast<jfloatArray>(array), native_ptr, copy_back_mode);
+        static_cast<jfloatArray>(array), native_ptr, release_mode);
+  }
+
+  // Copies |len| elements starting at |start| without pinning the array.
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jfloat* buf) {
+    jni::JniEnv::GetEnv()->GetFloatArrayRegion(
+        static_cast<jfloatArray>(array), start, len, buf);
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jfloat* buf) {
+    jni::JniEnv::GetEnv()->SetFloatArrayRegion(
+        static_cast<jfloatArray>(array), start, len, buf);
   }
 };
 
@@ -238,10 +340,22 @@ struct JniArrayHelper<jdouble, 1> : public JniArrayHelperBase {
   }
 
   static inline void ReleaseArrayElements(jarray array, jdouble* native_ptr,
-                                          bool copy_on_completion) {
-    const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
+                                          jint release_mode) {
     jni::JniEnv::GetEnv()->ReleaseDoubleArrayElements(
-        static_cast<jdoubleArray>(array), native_ptr, copy_back_mode);
+        static_cast<jdoubleArray>(array), native_ptr, release_mode);
+  }
+
+  // Copies |len| elements starting at |start| without pinning the array.
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jdouble* buf) {
+    jni::JniEnv::GetEnv()->GetDoubleArrayRegion(
+        static_cast<jdoubleArray>(array), start, len, buf);
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jdouble* buf) {
+    jni::JniEnv::GetEnv()->SetDoubleArrayRegion(
+        static_cast<jdoubleArray>(array), start, len, buf);
   }
 };
 
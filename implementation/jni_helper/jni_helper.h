@@ -36,6 +36,12 @@ class JniHelper {
   // Note, if the object is polymorphic it may be a sub or superclass.
   static jclass GetObjectClass(jobject object);
 
+  // Returns true if both references refer to the same Java object.
+  static bool IsSameObject(jobject lhs, jobject rhs);
+
+  // Returns true if |object| is an instance of |clazz| (or a subclass).
+  static bool IsInstanceOf(jobject object, jclass clazz);
+
   // Gets a method for a signature (no caching is performed).
   static inline jmethodID GetMethodID(jclass clazz, const char* method_name,
                                       const char* method_signature);
@@ -53,10 +59,54 @@ class JniHelper {
   static inline jfieldID GetStaticFieldID(jclass clazz, const char* field_name,
                                           const char* field_signature);
 
+  // Local reference frames.  |PushLocalFrame| returns false (with an
+  // OutOfMemoryError pending) if the frame couldn't be created.
+  static bool PushLocalFrame(jint capacity);
+
+  // Frees every local of the current frame except |result|, which is returned
+  // as a new local in the enclosing frame (nullptr is allowed).
+  static jobject PopLocalFrame(jobject result);
+
+  // Returns false (with an OutOfMemoryError pending) if |capacity| more locals
+  // can't be created in the current frame.
+  static bool EnsureLocalCapacity(jint capacity);
+
+  // Direct buffers.  |GetDirectBufferAddress| returns nullptr (and
+  // |GetDirectBufferCapacity| -1) if |buffer| isn't a direct java.nio.Buffer.
+  static jobject NewDirectByteBuffer(void* address, jlong capacity);
+
+  static void* GetDirectBufferAddress(jobject buffer);
+
+  static jlong GetDirectBufferCapacity(jobject buffer);
+
   // Strings.
   static const char* GetStringUTFChars(jstring str);
 
   static void ReleaseStringUTFChars(jstring str, const char* chars);
+
+  // Length in UTF-16 code units.
+  static jsize GetStringLength(jstring str);
+
+  // Length in modified UTF-8 bytes, excluding the null terminator.
+  static jsize GetStringUTFLength(jstring str);
+
+  // Region copies take |start| and |len| in UTF-16 code units and write into
+  // |buf| without allocating.
+  static void GetStringRegion(jstring str, jsize start, jsize len, jchar* buf);
+
+  static void GetStringUTFRegion(jstring str, jsize start, jsize len,
+                                 char* buf);
+
+  // UTF-16 pinning.  The returned chars are *not* null terminated.
+  static const jchar* GetStringChars(jstring str);
+
+  static void ReleaseStringChars(jstring str, const jchar* chars);
+
+  // Like |GetStringChars| but far more likely to avoid a copy.  No JNI calls
+  // (or blocking) may occur until the matching |ReleaseStringCritical|.
+  static const jchar* GetStringCritical(jstring str);
+
+  static void ReleaseStringCritical(jstring str, const jchar* chars);
 };
 
 //==============================================================================
@@ -69,6 +119,14 @@ inline jclass JniHelper::GetObjectClass(jobject object) {
   return jni::JniEnv::GetEnv()->GetObjectClass(object);
 }
 
+inline bool JniHelper::IsSameObject(jobject lhs, jobject rhs) {
+  return jni::JniEnv::GetEnv()->IsSameObject(lhs, rhs);
+}
+
+inline bool JniHelper::IsInstanceOf(jobject object, jclass clazz) {
+  return jni::JniEnv::GetEnv()->IsInstanceOf(object, clazz);
+}
+
 jmethodID JniHelper::GetMethodID(jclass clazz, const char* method_name,
                                  const char* method_signature) {
   return jni::JniEnv::GetEnv()->GetMethodID(clazz, method_name,
@@ -91,6 +149,30 @@ jfieldID JniHelper::GetStaticFieldID(jclass clazz, const char* name,
   return jni::JniEnv::GetEnv()->GetStaticFieldID(clazz, name, signature);
 }
 
+inline bool JniHelper::PushLocalFrame(jint capacity) {
+  return jni::JniEnv::GetEnv()->PushLocalFrame(capacity) == JNI_OK;
+}
+
+inline jobject JniHelper::PopLocalFrame(jobject result) {
+  return jni::JniEnv::GetEnv()->PopLocalFrame(result);
+}
+
+inline bool JniHelper::EnsureLocalCapacity(jint capacity) {
+  return jni::JniEnv::GetEnv()->EnsureLocalCapacity(capacity) == JNI_OK;
+}
+
+inline jobject JniHelper::NewDirectByteBuffer(void* address, jlong capacity) {
+  return jni::JniEnv::GetEnv()->NewDirectByteBuffer(address, capacity);
+}
+
+inline void* JniHelper::GetDirectBufferAddress(jobject buffer) {
+  return jni::JniEnv::GetEnv()->GetDirectBufferAddress(buffer);
+}
+
+inline jlong JniHelper::GetDirectBufferCapacity(jobject buffer) {
+  return jni::JniEnv::GetEnv()->GetDirectBufferCapacity(buffer);
+}
+
 inline const char* JniHelper::GetStringUTFChars(jstring str) {
   // If is_copy is an address of bool it will be set to true or false if a copy
   // is made.  That said, this seems to be of no consequence, as the API still
@@ -104,6 +186,40 @@ inline void JniHelper::ReleaseStringUTFChars(jstring str, const char* chars) {
   jni::JniEnv::GetEnv()->ReleaseStringUTFChars(str, chars);
 }
 
+inline jsize JniHelper::GetStringLength(jstring str) {
+  return jni::JniEnv::GetEnv()->GetStringLength(str);
+}
+
+inline jsize JniHelper::GetStringUTFLength(jstring str) {
+  return jni::JniEnv::GetEnv()->GetStringUTFLength(str);
+}
+
+inline void JniHelper::GetStringRegion(jstring str, jsize start, jsize len,
+                                       jchar* buf) {
+  jni::JniEnv::GetEnv()->GetStringRegion(str, start, len, buf);
+}
+
+inline void JniHelper::GetStringUTFRegion(jstring str, jsize start, jsize len,
+                                          char* buf) {
+  jni::JniEnv::GetEnv()->GetStringUTFRegion(str, start, len, buf);
+}
+
+inline const jchar* JniHelper::GetStringChars(jstring str) {
+  return jni::JniEnv::GetEnv()->GetStringChars(str, /*isCopy=*/nullptr);
+}
+
+inline void JniHelper::ReleaseStringChars(jstring str, const jchar* chars) {
+  jni::JniEnv::GetEnv()->ReleaseStringChars(str, chars);
+}
+
+inline const jchar* JniHelper::GetStringCritical(jstring str) {
+  return jni::JniEnv::GetEnv()->GetStringCritical(str, /*isCopy=*/nullptr);
+}
+
+inline void JniHelper::ReleaseStringCritical(jstring str, const jchar* chars) {
+  jni::JniEnv::GetEnv()->ReleaseStringCritical(str, chars);
+}
+
 }  // namespace jni
 
 #endif  // JNI_BIND_JNI_HELPER_JNI_HELPER_H_
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef JNI_BIND_IMPLEMENTATION_JNI_HELPER_JVALUE_H_
+#define JNI_BIND_IMPLEMENTATION_JNI_HELPER_JVALUE_H_
+
+#include <type_traits>
+
+#include "jni_dep.h"
+
+namespace jni {
+
+// Packs |val| as a jvalue holding the declared parameter type |CDecl| (e.g.
+// jint, jobject).  Reference types (objects, strings, and arrays of any rank)
+// are always packed as jobject.
+template <typename CDecl, typename T>
+inline jvalue ToJValue(T&& val) {
+  jvalue ret;
+
+  if constexpr (std::is_pointer_v<std::decay_t<T>>) {
+    ret.l = static_cast<jobject>(val);
+  } else if constexpr (std::is_same_v<CDecl, jboolean>) {
+    ret.z = static_cast<jboolean>(val);
+  } else if constexpr (std::is_same_v<CDecl, jbyte>) {
+    ret.b = static_cast<jbyte>(val);
+  } else if constexpr (std::is_same_v<CDecl, jchar>) {
+    ret.c = static_cast<jchar>(val);
+  } else if constexpr (std::is_same_v<CDecl, jshort>) {
+    ret.s = static_cast<jshort>(val);
+  } else if constexpr (std::is_same_v<CDecl, jint>) {
+    ret.i = static_cast<jint>(val);
+  } else if constexpr (std::is_same_v<CDecl, jlong>) {
+    ret.j = static_cast<jlong>(val);
+  } else if constexpr (std::is_same_v<CDecl, jfloat>) {
+    ret.f = static_cast<jfloat>(val);
+  } else if constexpr (std::is_same_v<CDecl, jdouble>) {
+    ret.d = static_cast<jdouble>(val);
+  } else {
+    ret.l = static_cast<jobject>(val);
+  }
+
+  return ret;
+}
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_JNI_HELPER_JVALUE_H_
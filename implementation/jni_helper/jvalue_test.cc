@@ -0,0 +1,52 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "jvalue.h"
+
+#include <gtest/gtest.h>
+#include "implementation/fake_test_constants.h"
+#include "jni_dep.h"
+
+namespace {
+
+using ::jni::ToJValue;
+using ::jni::test::Fake;
+
+TEST(JValue, PacksPrimitivesAsDeclaredType) {
+  EXPECT_EQ(ToJValue<jboolean>(true).z, JNI_TRUE);
+  EXPECT_EQ(ToJValue<jbyte>(jbyte{-1}).b, -1);
+  EXPECT_EQ(ToJValue<jchar>(jchar{'a'}).c, 'a');
+  EXPECT_EQ(ToJValue<jshort>(jshort{-2}).s, -2);
+  EXPECT_EQ(ToJValue<jint>(123).i, 123);
+  EXPECT_EQ(ToJValue<jlong>(jlong{1} << 40).j, jlong{1} << 40);
+  EXPECT_EQ(ToJValue<jfloat>(1.5f).f, 1.5f);
+  EXPECT_EQ(ToJValue<jdouble>(2.5).d, 2.5);
+}
+
+TEST(JValue, WidensArgumentsToDeclaredType) {
+  // e.g. an int literal passed for a long or double parameter.
+  EXPECT_EQ(ToJValue<jlong>(123).j, 123);
+  EXPECT_EQ(ToJValue<jdouble>(1.5f).d, 1.5);
+}
+
+TEST(JValue, PacksObjectsStringsAndArraysAsObjects) {
+  EXPECT_EQ(ToJValue<jobject>(Fake<jobject>()).l, Fake<jobject>());
+  EXPECT_EQ(ToJValue<jstring>(Fake<jstring>()).l, Fake<jstring>());
+  EXPECT_EQ(ToJValue<jintArray>(Fake<jintArray>()).l, Fake<jintArray>());
+  EXPECT_EQ(ToJValue<jobjectArray>(Fake<jobjectArray>()).l,
+            Fake<jobjectArray>());
+}
+
+}  // namespace
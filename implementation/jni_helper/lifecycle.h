@@ -16,8 +16,12 @@
 #ifndef JNI_BIND_IMPLEMENTATION_JNI_HELPER_LIFECYCLE_H_
 #define JNI_BIND_IMPLEMENTATION_JNI_HELPER_LIFECYCLE_H_
 
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 
+#include "global_ref_deletion_queue.h"
 #include "jni_env.h"
 #include "jni_dep.h"
 
@@ -26,19 +30,93 @@ namespace jni {
 enum class LifecycleType {
   LOCAL,
   GLOBAL,
-  // WEAK, // not implemented yet.
+  WEAK,
 };
 
 template <typename Span, LifecycleType lifecycle_type>
 struct LifecycleHelper;
 
+// Innermost scope on this thread in which locals are owned by their frame
+// (see |FrameOwnedLocals| and |LocalFrame|).  While set, deleting a local
+// created in it is skipped, as the frame frees it when popped.
+struct FrameOwnedLocalsState {
+  // Locals the frame is expected to hold, only checked in debug builds.
+  const std::size_t capacity_;
+  std::size_t num_left_to_frame_ = 0;
+  FrameOwnedLocalsState* const enclosing_;
+
+  // Unique per thread (unlike the address of the state), so a scope is never
+  // mistaken for an earlier one.
+  const std::uint64_t id_ = ++last_id_;
+
+  // False for a |LocalFrame| with |LocalOwnership::kObject|, whose locals are
+  // deleted individually until it is popped.
+  bool owns_locals_ = true;
+
+  // Set once the frame is popped.  Its remaining locals are already freed, so
+  // their deletes are skipped (uncounted), and new locals belong to the
+  // enclosing frame.
+  bool popped_ = false;
+
+  // Returns true if the delete of a local created in |created_in| is skipped.
+  static bool LeaveToFrame(std::uint64_t created_in) {
+    FrameOwnedLocalsState* frame = current_;
+    if (!frame || frame->id_ != created_in) {
+      return false;
+    }
+    if (frame->popped_) {
+      return true;
+    }
+    if (!frame->owns_locals_) {
+      return false;
+    }
+
+    ++frame->num_left_to_frame_;
+    assert(frame->num_left_to_frame_ <= frame->capacity_ &&
+           "More locals were left to the frame than its capacity.");
+    return true;
+  }
+
+  // Id of the scope new locals are created in, or 0 if there is none.
+  static std::uint64_t CurrentId() {
+    FrameOwnedLocalsState* frame = current_;
+    while (frame && frame->popped_) {
+      frame = frame->enclosing_;
+    }
+    return frame ? frame->id_ : 0;
+  }
+
+  static inline thread_local FrameOwnedLocalsState* current_ = nullptr;
+  static inline thread_local std::uint64_t last_id_ = 0;
+};
+
 // Shared implementation for local jobjects (jobject, jstring).
 template <typename Span>
 struct LifecycleLocalBase {
+  // For temporaries created and deleted in the same scope.
   static inline void Delete(Span object) {
+    Delete(object, FrameOwnedLocalsState::CurrentId());
+  }
+
+  // |created_in| is the |FrameOwnedLocalsState::CurrentId| when |object| was
+  // wrapped.  Locals from enclosing frames (or other scopes) are deleted as
+  // usual, as this frame won't free them.
+  static inline void Delete(Span object, std::uint64_t created_in) {
+    if (FrameOwnedLocalsState::LeaveToFrame(created_in)) {
+      return;
+    }
+
     JniEnv::GetEnv()->DeleteLocalRef(object);
   }
 
+  // Deletes |object| even under |FrameOwnedLocals|, for loops which hold one
+  // temporary local per iteration and would otherwise overflow the frame.
+  static inline void DeleteImmediately(Span object) {
+    if (object != nullptr) {
+      JniEnv::GetEnv()->DeleteLocalRef(object);
+    }
+  }
+
   static inline Span NewReference(Span object) {
     return static_cast<Span>(JniEnv::GetEnv()->NewLocalRef(object));
   }
@@ -61,8 +139,9 @@ struct LifecycleGlobalBase {
     return static_cast<Span>(ret);
   }
 
+  // Possibly deferred, see |GlobalRefDeletionQueue|.
   static inline void Delete(Span object) {
-    JniEnv::GetEnv()->DeleteGlobalRef(object);
+    GlobalRefDeletionQueue::Delete(object);
   }
 
   static inline Span NewReference(Span object) {
@@ -77,6 +156,32 @@ struct LifecycleHelper<Span, LifecycleType::GLOBAL>
   using Base::Base;
 };
 
+// Shared implementation for weak global jobjects.  Weak references don't keep
+// their referent alive, so they must be checked (or turned into a strong
+// reference) before use, see |WeakObject|.
+template <typename Span>
+struct LifecycleWeakBase {
+  static inline void Delete(Span object) {
+    JniEnv::GetEnv()->DeleteWeakGlobalRef(object);
+  }
+
+  static inline Span NewReference(Span object) {
+    return static_cast<Span>(JniEnv::GetEnv()->NewWeakGlobalRef(object));
+  }
+
+  // True if the referent has been garbage collected.
+  static inline bool IsCleared(Span object) {
+    return JniEnv::GetEnv()->IsSameObject(object, nullptr);
+  }
+};
+
+template <typename Span>
+struct LifecycleHelper<Span, LifecycleType::WEAK>
+    : public LifecycleWeakBase<Span> {
+  using Base = LifecycleWeakBase<Span>;
+  using Base::Base;
+};
+
 }  // namespace jni
 
 #endif  // JNI_BIND_IMPLEMENTATION_JNI_HELPER_LIFECYCLE_H_
@@ -29,6 +29,11 @@ struct LifecycleHelper<jobject, LifecycleType::LOCAL>
                                   CtorArgs&&... ctor_args) {
     return JniEnv::GetEnv()->NewObject(clazz, ctor_method, ctor_args...);
   }
+
+  static inline jobject ConstructA(jclass clazz, jmethodID ctor_method,
+                                   const jvalue* ctor_args) {
+    return JniEnv::GetEnv()->NewObjectA(clazz, ctor_method, ctor_args);
+  }
 };
 
 template <>
@@ -16,6 +16,8 @@
 #ifndef JNI_BIND_IMPLEMENTATION_JNI_HELPER_LIFECYCLE_STRING_H_
 #define JNI_BIND_IMPLEMENTATION_JNI_HELPER_LIFECYCLE_STRING_H_
 
+#include <string_view>
+
 #include "implementation/jni_helper/lifecycle.h"
 #include "implementation/jni_helper/lifecycle_object.h"
 
@@ -27,6 +29,13 @@ struct LifecycleHelper<jstring, LifecycleType::LOCAL>
   static inline jstring Construct(const char* chars) {
     return jni::JniEnv::GetEnv()->NewStringUTF(chars);
   }
+
+  // UTF-16 is Java's native encoding, so no transcoding is needed.
+  static inline jstring Construct(std::u16string_view str) {
+    return jni::JniEnv::GetEnv()->NewString(
+        reinterpret_cast<const jchar*>(str.data()),
+        static_cast<jsize>(str.size()));
+  }
 };
 
 template <>
@@ -42,6 +51,12 @@ struct LifecycleHelper<jstring, LifecycleType::GLOBAL>
 
     return global_string;
   }
+
+  // |Promote| releases the intermediate local.
+  static inline jstring Construct(std::u16string_view str) {
+    return Promote(
+        LifecycleHelper<jstring, LifecycleType::LOCAL>::Construct(str));
+  }
 };
 
 }  // namespace jni
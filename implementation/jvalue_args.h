@@ -0,0 +1,36 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_JVALUE_ARGS_H_
+#define JNI_BIND_IMPLEMENTATION_JVALUE_ARGS_H_
+
+namespace jni {
+
+// Tag that makes a |Class| invoke its methods and constructors by packing
+// arguments into a stack array of jvalue and calling the "A" variants of the
+// JNI calls (e.g. CallIntMethodA) rather than the C varargs entry points.
+// Parameter types are fully known at compile time, so this avoids the JVM
+// walking a va_list.
+//
+// e.g. Class{"kClass", JValueArgs{}, Method{...}}
+//
+// The choice is part of the definition rather than a build flag, so every
+// translation unit invokes a given class the same way.
+struct JValueArgs {};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_JVALUE_ARGS_H_
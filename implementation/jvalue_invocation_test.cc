@@ -0,0 +1,216 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Array;
+using ::jni::Class;
+using ::jni::Constructor;
+using ::jni::Final;
+using ::jni::JValueArgs;
+using ::jni::LocalArray;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::Return;
+using ::jni::Static;
+using ::jni::StaticRef;
+using ::jni::test::AsGlobal;
+using ::jni::test::Fake;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::StrEq;
+
+static constexpr Class kClass2{"kClass2"};
+
+static constexpr Class kClass{
+    "kClass",
+    JValueArgs{},
+    Constructor<jint, jdouble>{},
+    Static{Method{"StaticFoo", Return<jlong>{}, Params<jlong, jboolean>{}}},
+    Method{"Void", Return{}, Params{}},
+    Method{"Prims", Return<jint>{},
+           Params<jboolean, jbyte, jchar, jshort, jint, jlong, jfloat,
+                  jdouble>{}},
+    Method{"Objects", Return{kClass2},
+           Params{kClass2, jstring{}, Array<jint>{}}},
+};
+
+TEST_F(JniTest, JValueInvocation_UsesAVariantForVoidNullaryMethods) {
+  EXPECT_CALL(*env_, CallVoidMethodV).Times(0);
+  EXPECT_CALL(*env_, CallVoidMethodA(_, _, _));
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  obj("Void");
+}
+
+TEST_F(JniTest, JValueInvocation_OnlyAppliesToTaggedClasses) {
+  static constexpr Class kVarargsClass{"kVarargsClass",
+                                       Method{"Void", Return{}, Params{}}};
+
+  EXPECT_CALL(*env_, CallVoidMethodA).Times(0);
+  EXPECT_CALL(*env_, CallVoidMethodV(_, _, _));
+
+  LocalObject<kVarargsClass> obj{Fake<jobject>()};
+  obj("Void");
+}
+
+TEST_F(JniTest, JValueInvocation_TagCanPrecedeFinal) {
+  static constexpr Class kFinalClass{
+      "kFinalClass",
+      JValueArgs{},
+      Final{},
+      Method{"Void", Return{}, Params{}},
+  };
+
+  EXPECT_CALL(*env_, CallNonvirtualVoidMethodA(Fake<jobject>(), _, _, _));
+
+  LocalObject<kFinalClass> obj{Fake<jobject>()};
+  obj("Void");
+}
+
+TEST_F(JniTest, JValueInvocation_TagCanBeAddedToAnExistingDefinition) {
+  static constexpr Class kVarargsClass{"kVarargsClass",
+                                       Method{"Void", Return{}, Params{}}};
+  static constexpr decltype(kVarargsClass) kJValueClass{JValueArgs{},
+                                                        kVarargsClass};
+
+  EXPECT_CALL(*env_, CallVoidMethodV).Times(0);
+  EXPECT_CALL(*env_, CallVoidMethodA(_, _, _));
+
+  LocalObject<kJValueClass> obj{Fake<jobject>()};
+  obj("Void");
+}
+
+TEST_F(JniTest, JValueInvocation_PacksPrimitivesAsDeclaredTypes) {
+  EXPECT_CALL(*env_, CallIntMethodV).Times(0);
+  EXPECT_CALL(*env_, CallIntMethodA(Fake<jobject>(), _, _))
+      .WillOnce(Invoke([](jobject, jmethodID, const jvalue* args) {
+        EXPECT_EQ(args[0].z, JNI_TRUE);
+        EXPECT_EQ(args[1].b, 2);
+        EXPECT_EQ(args[2].c, 'c');
+        EXPECT_EQ(args[3].s, 4);
+        EXPECT_EQ(args[4].i, 5);
+        EXPECT_EQ(args[5].j, 6);
+        EXPECT_EQ(args[6].f, 7.f);
+        EXPECT_EQ(args[7].d, 8.);
+        return 123;
+      }));
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  EXPECT_EQ(obj("Prims", jboolean{true}, jbyte{2}, jchar{'c'}, jshort{4}, 5,
+                jlong{6}, 7.f, 8.),
+            123);
+}
+
+TEST_F(JniTest, JValueInvocation_PacksObjectsStringsAndArrays) {
+  EXPECT_CALL(*env_, NewStringUTF(StrEq("hello")))
+      .WillOnce(::testing::Return(Fake<jstring>()));
+  EXPECT_CALL(*env_, CallObjectMethodA(Fake<jobject>(1), _, _))
+      .WillOnce(Invoke([](jobject, jmethodID, const jvalue* args) {
+        EXPECT_EQ(args[0].l, Fake<jobject>(2));
+        EXPECT_EQ(args[1].l, Fake<jstring>());
+        EXPECT_EQ(args[2].l, Fake<jintArray>());
+        return Fake<jobject>(3);
+      }));
+
+  LocalObject<kClass> obj{Fake<jobject>(1)};
+  LocalObject<kClass2> obj2{Fake<jobject>(2)};
+  LocalArray<jint> arr{Fake<jintArray>()};
+  LocalObject<kClass2> ret = obj("Objects", obj2, "hello", arr);
+  EXPECT_EQ(static_cast<jobject>(ret), Fake<jobject>(3));
+}
+
+TEST_F(JniTest, JValueInvocation_PacksStaticMethodArgs) {
+  EXPECT_CALL(*env_, CallStaticLongMethodA(_, _, _))
+      .WillOnce(Invoke([](jclass, jmethodID, const jvalue* args) {
+        EXPECT_EQ(args[0].j, 123);
+        EXPECT_EQ(args[1].z, JNI_FALSE);
+        return jlong{456};
+      }));
+
+  EXPECT_EQ(StaticRef<kClass>{}("StaticFoo", jlong{123}, jboolean{false}),
+            456);
+}
+
+TEST_F(JniTest, JValueInvocation_PacksConstructorArgs) {
+  EXPECT_CALL(*env_, NewObjectV).Times(0);
+  EXPECT_CALL(*env_, NewObjectA(_, _, _))
+      .WillOnce(Invoke([](jclass, jmethodID, const jvalue* args) {
+        EXPECT_EQ(args[0].i, 1);
+        EXPECT_EQ(args[1].d, 2.5);
+        return Fake<jobject>();
+      }));
+
+  LocalObject<kClass> obj{1, 2.5};
+}
+
+TEST_F(JniTest, JValueInvocation_FinalMethodsUseNonvirtualAVariant) {
+  static constexpr Class kFinalClass{
+      "kFinalClass",
+      Final{},
+      JValueArgs{},
+      Method{"Foo", Return<jint>{}, Params<jlong>{}},
+  };
+
+  EXPECT_CALL(*env_, CallIntMethodA).Times(0);
+  EXPECT_CALL(*env_, CallNonvirtualIntMethodA(Fake<jobject>(),
+                                              AsGlobal(Fake<jclass>()), _, _))
+      .WillOnce(Invoke([](jobject, jclass, jmethodID, const jvalue* args) {
+        EXPECT_EQ(args[0].j, 5);
+        return 123;
+      }));
+
+  LocalObject<kFinalClass> obj{Fake<jobject>()};
+  EXPECT_EQ(obj("Foo", jlong{5}), 123);
+}
+
+TEST_F(JniTest, JValueInvocation_ContainerArraysOutliveTheCall) {
+  static constexpr Class kContainerClass{
+      "kContainerClass",
+      JValueArgs{},
+      Method{"Foo", Return{}, Params{Array{jint{}}}},
+  };
+
+  const std::vector<jint> ints{1, 2};
+
+  EXPECT_CALL(*env_, DeleteLocalRef).Times(AnyNumber());
+
+  InSequence seq;
+  EXPECT_CALL(*env_, NewIntArray(2))
+      .WillOnce(::testing::Return(Fake<jintArray>()));
+  EXPECT_CALL(*env_, CallVoidMethodA(Fake<jobject>(), _, _))
+      .WillOnce(Invoke([](jobject, jmethodID, const jvalue* args) {
+        EXPECT_EQ(args[0].l, Fake<jintArray>());
+      }));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jintArray>()));
+
+  LocalObject<kContainerClass> obj{Fake<jobject>()};
+  obj("Foo", ints);
+}
+
+}  // namespace
@@ -18,6 +18,7 @@
 #define JNI_BIND_JVM_REF_H_
 
 #include <atomic>
+#include <thread>
 #include <utility>
 
 #include "implementation/class.h"
@@ -26,10 +27,13 @@
 #include "implementation/default_class_loader.h"
 #include "implementation/field_ref.h"
 #include "implementation/forward_declarations.h"
+#include "implementation/jni_helper/global_ref_deletion_queue.h"
 #include "implementation/jni_helper/lifecycle_object.h"
 #include "implementation/jni_type.h"
 #include "implementation/jvm.h"
+#include "implementation/literal.h"
 #include "implementation/method_ref.h"
+#include "implementation/prewarm.h"
 #include "jni_dep.h"
 #include "metaprogramming/double_locked_value.h"
 #include "metaprogramming/function_traits.h"
@@ -85,6 +89,11 @@ class ThreadGuard {
  public:
   ~ThreadGuard() {
     thread_guard_count_--;
+
+    // The env is still valid here (detachment happens at thread exit).
+    if (thread_guard_count_ == 0) {
+      GlobalRefDeletionQueue::Drain();
+    }
   }
 
   ThreadGuard(ThreadGuard&) = delete;
@@ -207,29 +216,45 @@ class JvmRef : public JvmRefBase {
     //     by JvmRef::~JvmRef, and JvmRef cannot be moved, therefore it is
     //     guaranteed to be in a single threaded context.
     auto& default_loaded_class_list = GetDefaultLoadedClassList();
-    for (metaprogramming::DoubleLockedValue<jclass>* maybe_loaded_class_id :
-         default_loaded_class_list) {
-      maybe_loaded_class_id->Reset([](jclass clazz) {
-        LifecycleHelper<jobject, LifecycleType::GLOBAL>::Delete(clazz);
-      });
-    }
-    default_loaded_class_list.clear();
+    default_loaded_class_list.ForEach(
+        [](metaprogramming::DoubleLockedValue<jclass>* maybe_loaded_class_id) {
+          maybe_loaded_class_id->Reset([](jclass clazz) {
+            LifecycleHelper<jobject, LifecycleType::GLOBAL>::Delete(clazz);
+          });
+        });
+    default_loaded_class_list.Clear();
 
     // Methods do not need to be released, just forgotten.
     auto& default_loaded_method_ref_list = GetDefaultLoadedMethodList();
-    for (metaprogramming::DoubleLockedValue<jmethodID>* cached_method_id :
-         default_loaded_method_ref_list) {
-      cached_method_id->Reset();
-    }
-    default_loaded_method_ref_list.clear();
+    default_loaded_method_ref_list.ForEach(
+        [](metaprogramming::DoubleLockedValue<jmethodID>* cached_method_id) {
+          cached_method_id->Reset();
+        });
+    default_loaded_method_ref_list.Clear();
 
     // Fields do not need to be released, just forgotten.
     auto& default_loaded_field_ref_list = GetDefaultLoadedFieldList();
-    for (metaprogramming::DoubleLockedValue<jfieldID>* cached_field_id :
-         default_loaded_field_ref_list) {
-      cached_field_id->Reset();
-    }
-    default_loaded_field_ref_list.clear();
+    default_loaded_field_ref_list.ForEach(
+        [](metaprogramming::DoubleLockedValue<jfieldID>* cached_field_id) {
+          cached_field_id->Reset();
+        });
+    default_loaded_field_ref_list.Clear();
+
+    // Classes loaded through runtime loader instances.
+    GetLoaderLoadedClassCache().Clear();
+
+    // Interned string literals.
+    auto& literal_string_list = GetLiteralStringList();
+    literal_string_list.ForEach(
+        [](metaprogramming::DoubleLockedValue<jstring>* literal_string) {
+          literal_string->Reset([](jstring str) {
+            LifecycleHelper<jstring, LifecycleType::GLOBAL>::Delete(str);
+          });
+        });
+    literal_string_list.Clear();
+
+    // Includes any of the above if deletion is deferred.
+    GlobalRefDeletionQueue::Drain();
   }
 
   // Deleted in order to make various threading guarantees (see class_ref.h).
@@ -240,6 +265,35 @@ class JvmRef : public JvmRefBase {
   // If a JNIEnv does not exist, this will DetachCurrentThread when done.
   [[nodiscard]] ThreadGuard BuildThreadGuard() const { return {}; }
 
+  // Eagerly resolves the jclass and every jmethodID/jfieldID of the default
+  // loaded |class_vs| so that first calls don't pay for the lookups.
+  //
+  // This is purely opt-in, IDs are otherwise lazily resolved on first use.
+  // Classes loaded by custom loaders must be prewarmed through their
+  // |ClassLoaderRef| (see |ClassLoaderRef::Prewarm|).
+  template <const auto&... class_vs>
+  void Prewarm() const {
+    (Prewarmer<JniT<jobject, class_vs, kDefaultClassLoader,
+                    jvm_v_>>::PrewarmClassAndIds(),
+     ...);
+  }
+
+  // Same as |Prewarm| but performed on a newly attached background thread.
+  // The caller must join the returned thread before this |JvmRef| falls from
+  // scope.
+  //
+  // Note: FindClass on natively attached threads uses the system class
+  // loader, so this is only suitable for classes visible to it (e.g. not
+  // application classes on Android, for which call |Prewarm| from a thread
+  // that has the application loader, such as within JNI_OnLoad).
+  template <const auto&... class_vs>
+  [[nodiscard]] std::thread PrewarmOnBackgroundThread() const {
+    return std::thread{[this]() {
+      ThreadGuard thread_guard{};
+      Prewarm<class_vs...>();
+    }};
+  }
+
  private:
   // Main thread has a JNIEnv just like every other thread.
   const ThreadGuard thread_guard_ = {};
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_LITERAL_H_
+#define JNI_BIND_IMPLEMENTATION_LITERAL_H_
+
+#include <type_traits>
+
+#include "implementation/jni_helper/lifecycle.h"
+#include "implementation/jni_helper/lifecycle_string.h"
+#include "jni_dep.h"
+#include "metaprogramming/concurrent_registry.h"
+#include "metaprogramming/double_locked_value.h"
+
+namespace jni {
+
+// Used to detect |Literal| in type proxying.
+struct LiteralTag {};
+
+// Global strings created for |Literal|s, released on JvmRef teardown.
+static inline auto& GetLiteralStringList() {
+  static auto* ret_val = new metaprogramming::ConcurrentRegistry<
+      metaprogramming::DoubleLockedValue<jstring>*, 64>{};
+  return *ret_val;
+}
+
+// Interned Java string for a compile time constant, passable anywhere a
+// jstring argument is accepted.
+//
+// Passing a |const char*| or |std::string| builds a new local Java string on
+// every call.  A |Literal| is instead built once (on first use) as a global and
+// reused across calls and threads.
+//
+//   static constexpr char kTag[] = "constant tag";
+//   obj("Log", Literal<kTag>{});
+//
+// |str_v| must be a null terminated, modified UTF-8 string with static storage
+// duration (e.g. a constexpr char array or const char*).
+template <const auto& str_v>
+struct Literal : LiteralTag {
+  static_assert(std::is_convertible_v<decltype(str_v), const char*>,
+                "Literals must be null terminated character arrays.");
+
+  // Returns a global jstring which is valid until JvmRef teardown.
+  static jstring Get() {
+    static metaprogramming::DoubleLockedValue<jstring> global_string;
+
+    return global_string.LoadAndMaybeInit([]() {
+      GetLiteralStringList().Register(&global_string);
+
+      return LifecycleHelper<jstring, LifecycleType::GLOBAL>::Promote(
+          LifecycleHelper<jstring, LifecycleType::LOCAL>::Construct(str_v));
+    });
+  }
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_LITERAL_H_
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Class;
+using ::jni::JvmRef;
+using ::jni::kDefaultJvm;
+using ::jni::Literal;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::Return;
+using ::jni::Static;
+using ::jni::StaticRef;
+using ::jni::ThreadGuard;
+using ::jni::test::AsGlobal;
+using ::jni::test::Fake;
+using ::jni::test::JniTestWithNoDefaultJvmRef;
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::StrEq;
+
+static constexpr char kTag[] = "constant tag";
+static constexpr const char* kOtherTag = "other tag";
+
+static constexpr Class kClass{
+    "kClass",
+    Static{Method{"StaticLog", Return{}, Params<jstring>{}}},
+    Method{"Log", Return{}, Params<jstring>{}},
+    Method{"Log2", Return{}, Params<jstring, jstring>{}},
+};
+
+// The literal cache lives until JvmRef teardown, so tests scope their own.
+class LiteralTest : public JniTestWithNoDefaultJvmRef {
+ protected:
+  void SetUp() override {
+    JniTestWithNoDefaultJvmRef::SetUp();
+
+    ON_CALL(*env_, NewStringUTF(StrEq(kTag)))
+        .WillByDefault(::testing::Return(Fake<jstring>(1)));
+    ON_CALL(*env_, NewStringUTF(StrEq(kOtherTag)))
+        .WillByDefault(::testing::Return(Fake<jstring>(2)));
+
+    EXPECT_CALL(*env_, DeleteLocalRef).Times(AnyNumber());
+    EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jclass>())))
+        .Times(AnyNumber());
+  }
+
+  void TearDown() override {
+    default_globals_made_that_should_be_released_.clear();
+    JniTestWithNoDefaultJvmRef::TearDown();
+  }
+};
+
+TEST_F(LiteralTest, BuildsStringOnceAndReusesIt) {
+  JvmRef<kDefaultJvm> jvm_ref{jvm_.get()};
+
+  EXPECT_CALL(*env_, NewStringUTF(StrEq(kTag))).Times(1);
+  EXPECT_CALL(*env_, CallVoidMethodV(_, _, _)).Times(3);
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jstring>(1)))).Times(1);
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  obj("Log", Literal<kTag>{});
+  obj("Log", Literal<kTag>{});
+
+  static constexpr Literal<kTag> kTagLiteral{};
+  obj("Log", kTagLiteral);
+}
+
+TEST_F(LiteralTest, PassesGlobalStringAsArgument) {
+  JvmRef<kDefaultJvm> jvm_ref{jvm_.get()};
+
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jstring>(1))));
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jstring>(2))));
+
+  EXPECT_EQ(Literal<kTag>::Get(), AsGlobal(Fake<jstring>(1)));
+  EXPECT_EQ(Literal<kOtherTag>::Get(), AsGlobal(Fake<jstring>(2)));
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  obj("Log2", Literal<kTag>{}, Literal<kOtherTag>{});
+  StaticRef<kClass>{}("StaticLog", Literal<kOtherTag>{});
+}
+
+TEST_F(LiteralTest, IsRebuiltAfterJvmRefTeardown) {
+  EXPECT_CALL(*env_, NewStringUTF(StrEq(kTag))).Times(2);
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jstring>(1)))).Times(2);
+
+  for (int i = 0; i < 2; ++i) {
+    JvmRef<kDefaultJvm> jvm_ref{jvm_.get()};
+    Literal<kTag>::Get();
+    Literal<kTag>::Get();
+  }
+}
+
+TEST_F(LiteralTest, IsSharedAcrossThreads) {
+  JvmRef<kDefaultJvm> jvm_ref{jvm_.get()};
+
+  EXPECT_CALL(*env_, NewStringUTF(StrEq(kTag))).Times(1);
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jstring>(1)))).Times(1);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([] {
+      ThreadGuard thread_guard{};
+      EXPECT_EQ(Literal<kTag>::Get(), AsGlobal(Fake<jstring>(1)));
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+}  // namespace
@@ -21,11 +21,15 @@ namespace {
 
 using ::jni::ArrayView;
 using ::jni::Class;
+using ::jni::FlattenedArray;
+using ::jni::FrameOwnedLocals;
 using ::jni::LocalArray;
 using ::jni::LocalObject;
 using ::jni::test::Fake;
 using ::jni::test::JniTest;
 using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::InSequence;
 using ::testing::Return;
 using ::testing::StrEq;
 
@@ -225,4 +229,142 @@ TEST_F(JniTest, Array_2D_Iterates) {
   // 1 + 3 + 6 + 10 + 15 = 35
   EXPECT_EQ(sum, 35);
 }
+////////////////////////////////////////////////////////////////////////////////
+// Flattening.
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(JniTest, Array_FlattensJaggedRowsWithOneLocalAtATime) {
+  EXPECT_CALL(*env_, GetArrayLength(Fake<jobjectArray>()))
+      .WillOnce(Return(3));
+  EXPECT_CALL(*env_, GetIntArrayElements).Times(0);
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobjectArray>()));
+
+  InSequence seq;
+  EXPECT_CALL(*env_, GetObjectArrayElement(Fake<jobjectArray>(), 0))
+      .WillOnce(Return(Fake<jintArray>(1)));
+  EXPECT_CALL(*env_, GetArrayLength(Fake<jintArray>(1))).WillOnce(Return(3));
+  EXPECT_CALL(*env_, GetIntArrayRegion(Fake<jintArray>(1), 0, 3, _))
+      .WillOnce([](jintArray, jsize, jsize, jint* buf) {
+        buf[0] = 1;
+        buf[1] = 2;
+        buf[2] = 3;
+      });
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jintArray>(1)));
+
+  // Null rows are read as empty.
+  EXPECT_CALL(*env_, GetObjectArrayElement(Fake<jobjectArray>(), 1))
+      .WillOnce(Return(nullptr));
+
+  EXPECT_CALL(*env_, GetObjectArrayElement(Fake<jobjectArray>(), 2))
+      .WillOnce(Return(Fake<jintArray>(3)));
+  EXPECT_CALL(*env_, GetArrayLength(Fake<jintArray>(3))).WillOnce(Return(1));
+  EXPECT_CALL(*env_, GetIntArrayRegion(Fake<jintArray>(3), 0, 1, _))
+      .WillOnce([](jintArray, jsize, jsize, jint* buf) { buf[0] = 4; });
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jintArray>(3)));
+
+  LocalArray<jint, 2> arr{Fake<jobjectArray>()};
+  FlattenedArray<jint> flattened = arr.Flatten();
+
+  EXPECT_EQ(flattened.data, (std::vector<jint>{1, 2, 3, 4}));
+  EXPECT_EQ(flattened.offsets,
+            (std::vector<std::vector<std::size_t>>{{0, 3, 3, 4}}));
+  EXPECT_EQ(flattened.Size(), 3);
+  EXPECT_EQ(flattened.NumRows(), 3);
+  EXPECT_EQ(flattened.Row(2).second, 1);
+  EXPECT_FALSE(flattened.IsRectangular());
+}
+
+TEST_F(JniTest, Array_BuildsRank2ArrayFromRowMajorBuffer) {
+  FlattenedArray<jfloat> flattened = FlattenedArray<jfloat>::FromExtents(
+      {2, 3}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f});
+  EXPECT_TRUE(flattened.IsRectangular());
+  EXPECT_EQ(flattened.Extents(), (std::vector<std::size_t>{2, 3}));
+
+  EXPECT_CALL(*env_, NewObjectArray(2, _, nullptr))
+      .WillOnce(Return(Fake<jobjectArray>()));
+  EXPECT_CALL(*env_, NewFloatArray(3))
+      .WillOnce(Return(Fake<jfloatArray>(1)))
+      .WillOnce(Return(Fake<jfloatArray>(2)));
+  EXPECT_CALL(*env_, SetFloatArrayRegion(Fake<jfloatArray>(1), 0, 3,
+                                         flattened.data.data()));
+  EXPECT_CALL(*env_, SetFloatArrayRegion(Fake<jfloatArray>(2), 0, 3,
+                                         flattened.data.data() + 3));
+  EXPECT_CALL(*env_, SetObjectArrayElement(Fake<jobjectArray>(), 0,
+                                           Fake<jfloatArray>(1)));
+  EXPECT_CALL(*env_, SetObjectArrayElement(Fake<jobjectArray>(), 1,
+                                           Fake<jfloatArray>(2)));
+  EXPECT_CALL(*env_, DeleteLocalRef(_)).Times(AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jfloatArray>(1)));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jfloatArray>(2)));
+
+  LocalArray<jfloat, 2> arr{flattened};
+  EXPECT_EQ(static_cast<jobjectArray>(arr), Fake<jobjectArray>());
+}
+
+TEST_F(JniTest, Array_BuildsRank3ArrayFromJaggedShape) {
+  // {{{1, 2}}, {{3}, {}}}
+  FlattenedArray<jlong> flattened{{1, 2, 3}, {{0, 1, 3}, {0, 2, 3, 3}}};
+  EXPECT_FALSE(flattened.IsRectangular());
+
+  EXPECT_CALL(*env_, NewObjectArray(2, _, _)).Times(2);
+  EXPECT_CALL(*env_, NewObjectArray(1, _, _));
+  EXPECT_CALL(*env_, NewLongArray(2)).WillOnce(Return(Fake<jlongArray>(1)));
+  EXPECT_CALL(*env_, NewLongArray(1)).WillOnce(Return(Fake<jlongArray>(2)));
+  EXPECT_CALL(*env_, NewLongArray(0)).WillOnce(Return(Fake<jlongArray>(3)));
+  EXPECT_CALL(*env_, SetLongArrayRegion).Times(3);
+  EXPECT_CALL(*env_, SetObjectArrayElement).Times(5);
+
+  LocalArray<jlong, 3> arr{flattened};
+}
+
+TEST_F(JniTest, Array_FlattensUnderFrameOwnedLocalsWithOneRowAtATime) {
+  constexpr std::size_t kNumRows = 40;
+
+  EXPECT_CALL(*env_, GetArrayLength(Fake<jobjectArray>()))
+      .WillOnce(Return(kNumRows));
+  EXPECT_CALL(*env_, GetObjectArrayElement(Fake<jobjectArray>(), _))
+      .WillRepeatedly(Return(Fake<jintArray>()));
+  EXPECT_CALL(*env_, GetArrayLength(Fake<jintArray>()))
+      .WillRepeatedly(Return(2));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jintArray>())).Times(kNumRows);
+
+  // Far fewer than |kNumRows| locals are left to the frame.
+  FrameOwnedLocals frame_owned{1};
+  LocalArray<jint, 2> arr{Fake<jobjectArray>()};
+  FlattenedArray<jint> flattened = arr.Flatten();
+
+  EXPECT_EQ(flattened.data.size(), 2 * kNumRows);
+  EXPECT_EQ(frame_owned.NumLeftToFrame(), 0);
+}
+
+TEST_F(JniTest, Array_BuildsFromFlattenedUnderFrameOwnedLocals) {
+  constexpr std::size_t kNumRows = 40;
+
+  EXPECT_CALL(*env_, NewObjectArray(kNumRows, _, _))
+      .WillOnce(Return(Fake<jobjectArray>()));
+  EXPECT_CALL(*env_, NewIntArray(1))
+      .WillRepeatedly(Return(Fake<jintArray>()));
+  EXPECT_CALL(*env_, DeleteLocalRef(_)).Times(AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jintArray>())).Times(kNumRows);
+
+  FrameOwnedLocals frame_owned{1};
+  LocalArray<jint, 2> arr{FlattenedArray<jint>::FromExtents(
+      {kNumRows, 1}, std::vector<jint>(kNumRows))};
+
+  EXPECT_EQ(frame_owned.NumLeftToFrame(), 0);
+}
+
+#ifndef NDEBUG
+TEST_F(JniTest, Array_AssertsOnMismatchedFlattenedShapes) {
+  const std::vector<std::size_t> extents{2, 3};
+  const std::vector<jint> data{1, 2, 3, 4, 5};
+  EXPECT_DEATH({ FlattenedArray<jint>::FromExtents(extents, data); },
+               "doesn't match");
+
+  const FlattenedArray<jint> rank_2 =
+      FlattenedArray<jint>::FromExtents(extents, {1, 2, 3, 4, 5, 6});
+  using Rank3 = LocalArray<jint, 3>;
+  EXPECT_DEATH({ Rank3 arr{rank_2}; },
+               "flattened.Rank\\(\\) == JniT::kRank");
+}
+#endif  // NDEBUG
 }  // namespace
@@ -13,6 +13,11 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <array>
+#include <list>
+#include <type_traits>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "implementation/fake_test_constants.h"
@@ -36,6 +41,8 @@ using ::jni::Params;
 using ::jni::test::Fake;
 using ::jni::test::JniTest;
 using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::InSequence;
 using ::testing::Return;
 using ::testing::StrEq;
 
@@ -256,6 +263,170 @@ TEST_F(JniTest, Array_CachesLengthExactlyOnceOnFirstRequest) {
   EXPECT_EQ(obj.Length(), 5);
 }
 
+TEST_F(JniTest, Array_GetsRegionIntoCallerBuffer) {
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(Return(10));
+  EXPECT_CALL(*env_, GetIntArrayElements).Times(0);
+  EXPECT_CALL(*env_, GetIntArrayRegion(Fake<jintArray>(), 2, 3, _));
+
+  LocalArray<jint> arr{Fake<jintArray>()};
+  jint buf[3];
+  arr.GetRegion(2, 3, buf);
+}
+
+TEST_F(JniTest, Array_SetsRegionFromCallerBuffer) {
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(Return(10));
+  EXPECT_CALL(*env_, ReleaseFloatArrayElements).Times(0);
+
+  const jfloat buf[4]{1.f, 2.f, 3.f, 4.f};
+  EXPECT_CALL(*env_, SetFloatArrayRegion(Fake<jfloatArray>(), 6, 4, buf));
+
+  LocalArray<jfloat> arr{Fake<jfloatArray>()};
+  arr.SetRegion(6, 4, buf);
+}
+
+TEST_F(JniTest, Array_RegionsAcceptContiguousContainers) {
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(Return(8));
+
+  std::vector<jlong> vec(5);
+  std::array<jlong, 2> arr_buf{7, 8};
+  EXPECT_CALL(*env_, GetLongArrayRegion(Fake<jlongArray>(), 1, 5, vec.data()));
+  EXPECT_CALL(*env_,
+              SetLongArrayRegion(Fake<jlongArray>(), 6, 2, arr_buf.data()));
+
+  LocalArray<jlong> arr{Fake<jlongArray>()};
+  arr.GetRegion(1, vec);
+  arr.SetRegion(6, arr_buf);
+}
+
+#ifndef NDEBUG
+TEST_F(JniTest, Array_RegionBoundsChecksDoNotOverflow) {
+  EXPECT_CALL(*env_, GetArrayLength).WillRepeatedly(Return(10));
+
+  LocalArray<jint> arr{Fake<jintArray>()};
+  jint buf[2];
+  const std::size_t huge_offset = static_cast<std::size_t>(-1);
+  EXPECT_DEATH(arr.GetRegion(huge_offset, 2, buf), "offset <= Length\\(\\)");
+  EXPECT_DEATH(arr.SetRegion(huge_offset, 2, buf), "offset <= Length\\(\\)");
+}
+#endif  // NDEBUG
+
+TEST_F(JniTest, Array_ConstructsFromContainerWithSingleRegionCall) {
+  const std::vector<jint> vec{1, 2, 3};
+
+  EXPECT_CALL(*env_, NewIntArray(3)).WillOnce(Return(Fake<jintArray>()));
+  EXPECT_CALL(*env_, SetIntArrayRegion(Fake<jintArray>(), 0, 3, vec.data()));
+  EXPECT_CALL(*env_, GetIntArrayElements).Times(0);
+  EXPECT_CALL(*env_, GetArrayLength).Times(0);
+
+  LocalArray<jint> arr{vec};
+  EXPECT_EQ(arr.Length(), 3);
+}
+
+TEST_F(JniTest, Array_ConstructsEmptyArrayIfAllocationFails) {
+  const std::vector<jint> vec{1, 2, 3};
+
+  EXPECT_CALL(*env_, NewIntArray(3)).WillOnce(Return(nullptr));
+  EXPECT_CALL(*env_, SetIntArrayRegion).Times(0);
+  EXPECT_CALL(*env_, GetArrayLength).Times(0);
+
+  LocalArray<jint> arr{vec};
+  EXPECT_EQ(static_cast<jintArray>(arr), nullptr);
+  EXPECT_EQ(arr.Length(), 0);
+}
+
+TEST_F(JniTest, Array_ConstructsFromArraysAndIteratorRanges) {
+  const std::array<jdouble, 2> std_arr{1., 2.};
+  const jfloat c_arr[]{1.f, 2.f, 3.f, 4.f};
+  const std::list<jbyte> list{1, 2, 3};
+
+  EXPECT_CALL(*env_, NewDoubleArray(2)).WillOnce(Return(Fake<jdoubleArray>()));
+  EXPECT_CALL(*env_,
+              SetDoubleArrayRegion(Fake<jdoubleArray>(), 0, 2, std_arr.data()));
+  EXPECT_CALL(*env_, NewFloatArray(4)).WillOnce(Return(Fake<jfloatArray>()));
+  EXPECT_CALL(*env_, SetFloatArrayRegion(Fake<jfloatArray>(), 0, 4, c_arr));
+  EXPECT_CALL(*env_, NewFloatArray(2)).WillOnce(Return(Fake<jfloatArray>(2)));
+  EXPECT_CALL(*env_,
+              SetFloatArrayRegion(Fake<jfloatArray>(2), 0, 2, c_arr + 1));
+  EXPECT_CALL(*env_, NewByteArray(3)).WillOnce(Return(Fake<jbyteArray>()));
+  EXPECT_CALL(*env_, SetByteArrayRegion(Fake<jbyteArray>(), 0, 3, _));
+
+  LocalArray<jdouble> double_arr{std_arr};
+  LocalArray<jfloat> float_arr{c_arr};
+  LocalArray<jfloat> float_range_arr{c_arr + 1, c_arr + 3};
+  LocalArray<jbyte> byte_arr{list.begin(), list.end()};
+}
+
+TEST_F(JniTest, Array_CopiesOutWithSingleRegionCall) {
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(Return(3));
+  EXPECT_CALL(*env_, GetLongArrayElements).Times(0);
+  EXPECT_CALL(*env_, GetLongArrayRegion(Fake<jlongArray>(), 0, 3, _))
+      .Times(2)
+      .WillRepeatedly([](jlongArray, jsize, jsize len, jlong* buf) {
+        for (jsize i = 0; i < len; ++i) {
+          buf[i] = i * 10;
+        }
+      });
+
+  LocalArray<jlong> arr{Fake<jlongArray>()};
+  EXPECT_EQ(arr.ToVector(), (std::vector<jlong>{0, 10, 20}));
+
+  std::array<jlong, 4> out{-1, -1, -1, -1};
+  arr.CopyTo(out);
+  EXPECT_EQ(out, (std::array<jlong, 4>{0, 10, 20, -1}));
+}
+
+TEST_F(JniTest, Array_ContainersArePassedAsTemporaryArrays) {
+  static constexpr Class kClass{
+      "kClass",
+      Method{"Ints", jni::Return{}, Params{Array{jint{}}}},
+      Method{"Sum", jni::Return<jint>{}, Params{Array{jfloat{}}, jint{}}},
+      Field{"doubles", Array{jdouble{}}},
+  };
+
+  const std::vector<jint> ints{1, 2, 3};
+  const std::array<jfloat, 2> floats{1.f, 2.f};
+  const std::vector<jdouble> doubles{1.};
+
+  EXPECT_CALL(*env_, DeleteLocalRef(_)).Times(AnyNumber());
+
+  InSequence seq;
+  EXPECT_CALL(*env_, NewIntArray(3)).WillOnce(Return(Fake<jintArray>()));
+  EXPECT_CALL(*env_, SetIntArrayRegion(Fake<jintArray>(), 0, 3, ints.data()));
+  EXPECT_CALL(*env_, CallVoidMethodV(Fake<jobject>(), _, _));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jintArray>()));
+
+  EXPECT_CALL(*env_, NewFloatArray(2)).WillOnce(Return(Fake<jfloatArray>()));
+  EXPECT_CALL(*env_,
+              SetFloatArrayRegion(Fake<jfloatArray>(), 0, 2, floats.data()));
+  EXPECT_CALL(*env_, CallIntMethodV(Fake<jobject>(), _, _))
+      .WillOnce(Return(3));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jfloatArray>()));
+
+  EXPECT_CALL(*env_, NewDoubleArray(1)).WillOnce(Return(Fake<jdoubleArray>()));
+  EXPECT_CALL(*env_, SetDoubleArrayRegion(Fake<jdoubleArray>(), 0, 1, _));
+  EXPECT_CALL(*env_, SetObjectField(Fake<jobject>(), _, Fake<jdoubleArray>()));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jdoubleArray>()));
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  obj("Ints", ints);
+  EXPECT_EQ(obj("Sum", floats, 2), 3);
+  obj["doubles"].Set(doubles);
+}
+
+TEST_F(JniTest, Array_ContainersOnlyMatchTheirSpanType) {
+  static constexpr Class kClass{
+      "kClass",
+      Method{"Foo", jni::Overload{jni::Return<jint>{}, Params{Array{jint{}}}},
+             jni::Overload{jni::Return<jlong>{}, Params{Array{jlong{}}}}},
+  };
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  static_assert(
+      std::is_same_v<decltype(obj("Foo", std::vector<jint>{})), jint>);
+  static_assert(
+      std::is_same_v<decltype(obj("Foo", std::vector<jlong>{})), jlong>);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // String Array Tests.
 // Strings are unusual in that they have their own type (jstring) but are
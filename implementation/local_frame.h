@@ -0,0 +1,187 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_LOCAL_FRAME_H_
+#define JNI_BIND_IMPLEMENTATION_LOCAL_FRAME_H_
+
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "implementation/jni_helper/jni_helper.h"
+#include "implementation/jni_helper/lifecycle.h"
+#include "jni_dep.h"
+
+namespace jni {
+
+// While in scope, local wrappers (LocalObject, LocalString, LocalArray, etc.)
+// destroyed on this thread skip |DeleteLocalRef| and leave their reference to
+// be freed with the enclosing frame.
+//
+// Inside a native method, the VM frees every local on return, so the
+// per-object deletes are only extra JNI transitions:
+//
+//   JNIEXPORT void JNICALL Java_Foo_bar(JNIEnv* env, jobject) {
+//     FrameOwnedLocals frame_owned{};
+//     for (int i = 0; i < 10; ++i) {
+//       LocalObject<kClass> temp{};  // Freed when |bar| returns.
+//     }
+//   }
+//
+// This must only be used when a frame pop follows (the native method returns,
+// or see |LocalFrame|'s |LocalOwnership::kFrame|).  Only wrappers created in
+// scope are left to the frame; those created before it (e.g. in an enclosing
+// frame) are deleted as usual and don't count toward |capacity|.  A moved
+// wrapper counts as created where it was moved to.
+//
+// Capacity for |capacity| locals is reserved (see |Ok|), and debug builds count
+// locals left to the frame and assert if it is exceeded.
+//
+// |ScopedElements| iterators (|Elements()|), |Flatten| and construction from a
+// |FlattenedArray| always delete their rows, so they only hold one slot.  Loops
+// over |Get(i)| leave one local per element, so prefer |Elements()|.
+class FrameOwnedLocals {
+ public:
+  static constexpr jint kDefaultCapacity = 16;
+
+  explicit FrameOwnedLocals(jint capacity = kDefaultCapacity)
+      : state_{static_cast<std::size_t>(capacity), 0,
+               FrameOwnedLocalsState::current_},
+        reserved_(JniHelper::EnsureLocalCapacity(capacity)) {
+    FrameOwnedLocalsState::current_ = &state_;
+  }
+
+  FrameOwnedLocals(const FrameOwnedLocals&) = delete;
+  FrameOwnedLocals(FrameOwnedLocals&&) = delete;
+  FrameOwnedLocals& operator=(const FrameOwnedLocals&) = delete;
+  FrameOwnedLocals& operator=(FrameOwnedLocals&&) = delete;
+
+  ~FrameOwnedLocals() { FrameOwnedLocalsState::current_ = state_.enclosing_; }
+
+  // Returns false if |capacity| couldn't be reserved (an OutOfMemoryError will
+  // be pending).
+  bool Ok() const { return reserved_; }
+
+  // Number of deletes skipped (i.e. locals left to the frame) so far.
+  std::size_t NumLeftToFrame() const { return state_.num_left_to_frame_; }
+
+ private:
+  FrameOwnedLocalsState state_;
+  const bool reserved_;
+};
+
+// Whether locals created in a |LocalFrame| are deleted individually (as
+// usual), or left for the frame to free when it is popped.
+enum class LocalOwnership {
+  kObject,
+  kFrame,
+};
+
+// Scopes a JNI local reference frame (PushLocalFrame / PopLocalFrame).
+//
+// Capacity for |capacity| locals is reserved up front, and every local created
+// while the frame is alive is freed when it is popped.  This includes locals
+// that are never wrapped in an RAII object, e.g. the temporary strings created
+// when passing |const char*| or |std::string| as method arguments.
+//
+// One result (e.g. LocalObject, LocalArray, LocalString) can be promoted to the
+// enclosing frame with |Pop|:
+//
+//   LocalObject<kClass> result = [&] {
+//     LocalFrame frame{kCapacity};
+//     LocalObject<kClass> obj{};
+//     for (int i = 0; i < kNumIterations; ++i) {
+//       obj("Append", "some string");
+//     }
+//     return frame.Pop(std::move(obj));
+//   }();
+//
+// |Pop| ends the frame.  Other locals created in it may still be in scope, but
+// are invalid: their deletes are skipped, as popping already freed them.  The
+// popped result (and locals created after |Pop|) belong to the enclosing frame
+// and are deleted as usual.
+//
+// With |LocalOwnership::kFrame|, locals destroyed while the frame is alive also
+// skip |DeleteLocalRef| (see |FrameOwnedLocals|), as popping frees them anyway.
+class LocalFrame {
+ public:
+  static constexpr jint kDefaultCapacity = 16;
+
+  explicit LocalFrame(jint capacity = kDefaultCapacity,
+                      LocalOwnership ownership = LocalOwnership::kObject)
+      : pushed_(JniHelper::PushLocalFrame(capacity)) {
+    // Without a frame of its own, locals would leak into the enclosing one, so
+    // they are deleted as usual.  Unlike |FrameOwnedLocals|, no reserve is
+    // needed, as pushing reserved |capacity|.
+    if (pushed_) {
+      state_.emplace(FrameOwnedLocalsState{static_cast<std::size_t>(capacity),
+                                           0, FrameOwnedLocalsState::current_});
+      state_->owns_locals_ = ownership == LocalOwnership::kFrame;
+      FrameOwnedLocalsState::current_ = &*state_;
+    }
+  }
+
+  LocalFrame(const LocalFrame&) = delete;
+  LocalFrame(LocalFrame&&) = delete;
+  LocalFrame& operator=(const LocalFrame&) = delete;
+  LocalFrame& operator=(LocalFrame&&) = delete;
+
+  ~LocalFrame() {
+    if (state_) {
+      FrameOwnedLocalsState::current_ = state_->enclosing_;
+    }
+    if (pushed_) {
+      JniHelper::PopLocalFrame(nullptr);
+    }
+  }
+
+  // Returns false if the frame couldn't be pushed (an OutOfMemoryError will be
+  // pending).  Locals will then be created in the enclosing frame.
+  bool Ok() const { return pushed_; }
+
+  // Ensures |capacity| more locals can be created in the current frame.
+  static bool EnsureLocalCapacity(jint capacity) {
+    return JniHelper::EnsureLocalCapacity(capacity);
+  }
+
+  // Pops the frame, returning |result| as a local of the enclosing frame.
+  template <typename T>
+  T Pop(T&& result) {
+    static_assert(!std::is_lvalue_reference_v<T>,
+                  "Pop takes ownership of its result, use std::move.");
+    using StorageType = decltype(result.Release());
+
+    jobject local = static_cast<jobject>(result.Release());
+    if (pushed_) {
+      pushed_ = false;
+      local = JniHelper::PopLocalFrame(local);
+      state_->popped_ = true;
+    }
+
+    return T{static_cast<StorageType>(local)};
+  }
+
+ private:
+  bool pushed_;
+
+  // Tracks which locals were created in this frame (see |Pop|).
+  std::optional<FrameOwnedLocalsState> state_;
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_LOCAL_FRAME_H_
@@ -0,0 +1,321 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <optional>
+#include <utility>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Class;
+using ::jni::FrameOwnedLocals;
+using ::jni::LocalArray;
+using ::jni::LocalFrame;
+using ::jni::LocalObject;
+using ::jni::LocalOwnership;
+using ::jni::LocalString;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::Return;
+using ::jni::test::Fake;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::InSequence;
+using ::testing::Sequence;
+using ::testing::StrEq;
+
+static constexpr Class kClass{"kClass",
+                              Method{"Foo", Return{}, Params<jstring>{}}};
+
+TEST_F(JniTest, LocalFrame_PushesAndPopsWithCapacity) {
+  InSequence seq;
+  EXPECT_CALL(*env_, PushLocalFrame(LocalFrame::kDefaultCapacity));
+  EXPECT_CALL(*env_, PopLocalFrame(nullptr));
+
+  LocalFrame frame;
+  EXPECT_TRUE(frame.Ok());
+}
+
+TEST_F(JniTest, LocalFrame_ReleasesLocalsCreatedInsideFrame) {
+  // The class lookup's local is released independently of the frame.
+  EXPECT_CALL(*env_, DeleteLocalRef(_)).Times(AnyNumber());
+
+  Sequence seq;
+  EXPECT_CALL(*env_, PushLocalFrame(64)).InSequence(seq);
+  EXPECT_CALL(*env_, NewStringUTF(StrEq("leaked"))).Times(3).InSequence(seq);
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>())).InSequence(seq);
+  EXPECT_CALL(*env_, PopLocalFrame(nullptr)).InSequence(seq);
+
+  LocalFrame frame{64};
+  LocalObject<kClass> obj{Fake<jobject>()};
+  for (int i = 0; i < 3; ++i) {
+    obj("Foo", "leaked");
+  }
+}
+
+TEST_F(JniTest, LocalFrame_DoesNotPopIfPushFails) {
+  EXPECT_CALL(*env_, PushLocalFrame(_)).WillOnce(::testing::Return(JNI_ENOMEM));
+  EXPECT_CALL(*env_, PopLocalFrame).Times(0);
+
+  LocalFrame frame;
+  EXPECT_FALSE(frame.Ok());
+}
+
+TEST_F(JniTest, LocalFrame_EnsuresCapacity) {
+  EXPECT_CALL(*env_, EnsureLocalCapacity(10))
+      .WillOnce(::testing::Return(JNI_OK));
+  EXPECT_CALL(*env_, EnsureLocalCapacity(20))
+      .WillOnce(::testing::Return(JNI_ERR));
+
+  EXPECT_TRUE(LocalFrame::EnsureLocalCapacity(10));
+  EXPECT_FALSE(LocalFrame::EnsureLocalCapacity(20));
+}
+
+TEST_F(JniTest, LocalFrame_PromotesObjectToEnclosingFrame) {
+  InSequence seq;
+  EXPECT_CALL(*env_, PushLocalFrame);
+  EXPECT_CALL(*env_, PopLocalFrame(Fake<jobject>(1)))
+      .WillOnce(::testing::Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(2)));
+
+  LocalObject<kClass> result = [] {
+    LocalFrame frame;
+    LocalObject<kClass> obj{Fake<jobject>(1)};
+    return frame.Pop(std::move(obj));
+  }();
+
+  EXPECT_EQ(static_cast<jobject>(result), Fake<jobject>(2));
+}
+
+TEST_F(JniTest, LocalFrame_PromotesStringsAndArrays) {
+  EXPECT_CALL(*env_, PopLocalFrame(Fake<jstring>(1)))
+      .WillOnce(::testing::Return(Fake<jstring>(2)));
+  EXPECT_CALL(*env_, PopLocalFrame(Fake<jintArray>(1)))
+      .WillOnce(::testing::Return(Fake<jintArray>(2)));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jstring>(2)));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jintArray>(2)));
+
+  LocalString str = [] {
+    LocalFrame frame;
+    return frame.Pop(LocalString{Fake<jstring>(1)});
+  }();
+  LocalArray<jint> arr = [] {
+    LocalFrame frame;
+    return frame.Pop(LocalArray<jint>{Fake<jintArray>(1)});
+  }();
+
+  EXPECT_EQ(static_cast<jstring>(str), Fake<jstring>(2));
+  EXPECT_EQ(static_cast<jintArray>(arr), Fake<jintArray>(2));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(JniTest, LocalFrame_SkipsDeletesOfLocalsStillLiveAtPop) {
+  InSequence seq;
+  EXPECT_CALL(*env_, PushLocalFrame);
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(3)));
+  EXPECT_CALL(*env_, PopLocalFrame(Fake<jobject>(1)))
+      .WillOnce(::testing::Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(5)));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(4))).Times(0);
+  EXPECT_CALL(*env_, PopLocalFrame).Times(0);
+
+  LocalObject<kClass> result = [] {
+    LocalFrame frame;
+    { LocalObject<kClass> temp{Fake<jobject>(3)}; }
+
+    // Still in scope at |Pop|, but freed with the frame.
+    LocalObject<kClass> other{Fake<jobject>(4)};
+    LocalObject<kClass> obj{Fake<jobject>(1)};
+    LocalObject<kClass> popped = frame.Pop(std::move(obj));
+
+    // Created in the enclosing frame.
+    LocalObject<kClass> after_pop{Fake<jobject>(5)};
+    return popped;
+  }();
+}
+
+TEST_F(JniTest, LocalFrame_FrameOwnershipSkipsDeletesOfLocalsLiveAtPop) {
+  EXPECT_CALL(*env_, PushLocalFrame(2));
+  EXPECT_CALL(*env_, PopLocalFrame(Fake<jobject>(1)))
+      .WillOnce(::testing::Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, DeleteLocalRef).Times(0);
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(2)));
+
+  LocalFrame frame{2, LocalOwnership::kFrame};
+  LocalObject<kClass> other_1{Fake<jobject>(3)};
+  LocalObject<kClass> other_2{Fake<jobject>(4)};
+  LocalObject<kClass> result =
+      frame.Pop(LocalObject<kClass>{Fake<jobject>(1)});
+}
+
+// Frame owned locals.
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(JniTest, FrameOwnedLocals_SkipsDeleteLocalRef) {
+  EXPECT_CALL(*env_, DeleteLocalRef).Times(0);
+
+  FrameOwnedLocals frame_owned{};
+  {
+    LocalObject<kClass> obj{Fake<jobject>()};
+    LocalString str{Fake<jstring>()};
+    LocalArray<jint> arr{Fake<jintArray>()};
+  }
+
+  EXPECT_EQ(frame_owned.NumLeftToFrame(), 3);
+}
+
+TEST_F(JniTest, FrameOwnedLocals_DeletesAgainOnceOutOfScope) {
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(2)));
+
+  {
+    FrameOwnedLocals frame_owned{};
+    LocalObject<kClass> obj{Fake<jobject>(1)};
+  }
+
+  LocalObject<kClass> obj{Fake<jobject>(2)};
+}
+
+TEST_F(JniTest, FrameOwnedLocals_CountsPerScope) {
+  EXPECT_CALL(*env_, DeleteLocalRef).Times(0);
+
+  FrameOwnedLocals outer{};
+  { LocalObject<kClass> obj{Fake<jobject>()}; }
+  {
+    FrameOwnedLocals inner{};
+    LocalObject<kClass> obj_1{Fake<jobject>(1)};
+    LocalObject<kClass> obj_2{Fake<jobject>(2)};
+    obj_1.Release();
+  }
+
+  EXPECT_EQ(outer.NumLeftToFrame(), 1);
+}
+
+TEST_F(JniTest, FrameOwnedLocals_DeletesLocalsCreatedBeforeScope) {
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(1)));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(3))).Times(0);
+
+  std::optional<LocalObject<kClass>> before_outer{Fake<jobject>(1)};
+  FrameOwnedLocals outer{1};
+  std::optional<LocalObject<kClass>> before_inner{Fake<jobject>(2)};
+  {
+    FrameOwnedLocals inner{1};
+    LocalObject<kClass> obj{Fake<jobject>(3)};
+
+    // Neither is freed by this scope's frame, nor counts toward its capacity.
+    before_outer.reset();
+    before_inner.reset();
+    EXPECT_EQ(inner.NumLeftToFrame(), 0);
+  }
+
+  EXPECT_EQ(outer.NumLeftToFrame(), 0);
+}
+
+TEST_F(JniTest, LocalFrame_FrameOwnershipSkipsDeletesInsideFrame) {
+  EXPECT_CALL(*env_, PushLocalFrame(4)).WillOnce(::testing::Return(JNI_OK));
+  EXPECT_CALL(*env_, PopLocalFrame(Fake<jobject>(1)))
+      .WillOnce(::testing::Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, DeleteLocalRef).Times(0);
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(2)));
+
+  LocalObject<kClass> result = [] {
+    LocalFrame frame{4, LocalOwnership::kFrame};
+    { LocalObject<kClass> temp{Fake<jobject>(3)}; }
+    LocalObject<kClass> obj{Fake<jobject>(1)};
+    return frame.Pop(std::move(obj));
+  }();
+
+  EXPECT_EQ(static_cast<jobject>(result), Fake<jobject>(2));
+}
+
+TEST_F(JniTest, LocalFrame_FrameOwnershipEndsWithPop) {
+  InSequence seq;
+  EXPECT_CALL(*env_, PushLocalFrame(4));
+  EXPECT_CALL(*env_, PopLocalFrame(Fake<jobject>(1)))
+      .WillOnce(::testing::Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, PopLocalFrame).Times(0);
+
+  LocalFrame frame{4, LocalOwnership::kFrame};
+  {
+    // Lives in the enclosing frame, so it mustn't be left to this one.
+    LocalObject<kClass> result =
+        frame.Pop(LocalObject<kClass>{Fake<jobject>(1)});
+  }
+}
+
+TEST_F(JniTest, FrameOwnedLocals_ReservesCapacity) {
+  EXPECT_CALL(*env_, EnsureLocalCapacity(32))
+      .WillOnce(::testing::Return(JNI_OK));
+  EXPECT_CALL(*env_, EnsureLocalCapacity(64))
+      .WillOnce(::testing::Return(JNI_ERR));
+
+  EXPECT_TRUE(FrameOwnedLocals{32}.Ok());
+  EXPECT_FALSE(FrameOwnedLocals{64}.Ok());
+}
+
+TEST_F(JniTest, LocalFrame_FrameOwnershipDoesNotReserveTwice) {
+  EXPECT_CALL(*env_, PushLocalFrame(32)).WillOnce(::testing::Return(JNI_OK));
+  EXPECT_CALL(*env_, EnsureLocalCapacity).Times(0);
+
+  LocalFrame frame{32, LocalOwnership::kFrame};
+}
+
+TEST_F(JniTest, FrameOwnedLocals_ScopedElementsAreAlwaysDeleted) {
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(::testing::Return(20));
+  EXPECT_CALL(*env_, GetObjectArrayElement)
+      .WillRepeatedly(::testing::Return(Fake<jobject>()));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>())).Times(20);
+
+  // Even with 20 elements, each is deleted before the next is fetched, so a
+  // capacity of 1 suffices.
+  FrameOwnedLocals frame_owned{1};
+  LocalArray<jobject, 1, kClass> arr{Fake<jobjectArray>()};
+  for (auto& obj : arr.Elements()) {
+    EXPECT_EQ(static_cast<jobject>(obj), Fake<jobject>());
+  }
+
+  EXPECT_EQ(frame_owned.NumLeftToFrame(), 0);
+}
+
+TEST_F(JniTest, LocalFrame_FrameOwnershipRequiresAPushedFrame) {
+  EXPECT_CALL(*env_, PushLocalFrame).WillOnce(::testing::Return(JNI_ERR));
+  EXPECT_CALL(*env_, PopLocalFrame).Times(0);
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>()));
+
+  LocalFrame frame{4, LocalOwnership::kFrame};
+  LocalObject<kClass> obj{Fake<jobject>()};
+}
+
+#ifndef NDEBUG
+TEST_F(JniTest, FrameOwnedLocals_AssertsIfCapacityIsExceeded) {
+  EXPECT_DEATH(
+      {
+        FrameOwnedLocals frame_owned{1};
+        LocalObject<kClass> obj_1{Fake<jobject>(1)};
+        LocalObject<kClass> obj_2{Fake<jobject>(2)};
+      },
+      "capacity");
+}
+#endif  // NDEBUG
+
+}  // namespace
@@ -17,6 +17,11 @@
 #ifndef JNI_BIND_LOCAL_STRING_H_
 #define JNI_BIND_LOCAL_STRING_H_
 
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
 #include "class_defs/java_lang_classes.h"
 #include "implementation/jni_helper/jni_helper.h"
 #include "implementation/jni_helper/lifecycle_string.h"
@@ -48,9 +53,43 @@ class LocalString : public LocalStringImpl {
   LocalString(LocalObject<kJavaLangString>&& obj)
       : Base(static_cast<jstring>(obj.Release())) {}
 
+  // Builds from UTF-16 with |NewString|, which skips transcoding (and the
+  // String(String) constructor used for other arguments).
+  template <typename T, typename = std::enable_if_t<
+                            std::is_convertible_v<T, std::u16string_view>>>
+  LocalString(T&& str)
+      : Base(LifecycleHelper<jstring, LifecycleType::LOCAL>::Construct(
+            std::u16string_view{std::forward<T>(str)})) {}
+
   // Returns a StringView which possibly performs an expensive pinning
   // operation.  String objects can be pinned multiple times.
   UtfStringView Pin() { return {RefBaseTag<jstring>::object_ref_}; }
+
+  // Returns a UTF-16 view which is usually a direct view of the string (see
+  // |Utf16StringView|).
+  Utf16StringView PinUtf16(bool critical = false) {
+    return Utf16StringView{RefBaseTag<jstring>::object_ref_, critical};
+  }
+
+  // Copies the string as modified UTF-8 into |buf| without allocating, see
+  // |StringRegion::CopyUtf|.  Returns the length in bytes.
+  std::size_t CopyUtf(char* buf, std::size_t buf_size) {
+    return StringRegion::CopyUtf(RefBaseTag<jstring>::object_ref_, buf,
+                                 buf_size);
+  }
+
+  // Copies the string's UTF-16 code units into |buf| without allocating.
+  // Returns the length in code units.
+  std::size_t CopyUtf16(jchar* buf, std::size_t buf_size) {
+    return StringRegion::CopyUtf16(RefBaseTag<jstring>::object_ref_, buf,
+                                   buf_size);
+  }
+
+  // Returns a copy which only allocates if longer than |kInlineSize|.
+  template <std::size_t kInlineSize = 64>
+  InlineUtfString<kInlineSize> ReadUtf() {
+    return InlineUtfString<kInlineSize>{RefBaseTag<jstring>::object_ref_};
+  }
 };
 
 }  // namespace jni
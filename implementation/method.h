@@ -20,6 +20,7 @@
 #include <tuple>
 #include <type_traits>
 
+#include "implementation/final.h"
 #include "params.h"
 
 namespace jni {
@@ -50,6 +51,9 @@ struct Method<std::tuple<Returns...>, std::tuple<Params_...>>
   const char* name_;
   const std::tuple<Overload<Returns, Params_>...> invocations_;
 
+  // See |Final|.
+  const bool is_final_ = false;
+
   template <typename ReturnT_, typename ParamsT_,
             std::enable_if_t<std::is_base_of_v<ParamsBase, ParamsT_>, int> = 0>
   constexpr Method(const char* name, ReturnT_ return_type, ParamsT_ params)
@@ -57,6 +61,18 @@ struct Method<std::tuple<Returns...>, std::tuple<Params_...>>
 
   constexpr Method(const char* name, Overload<Returns, Params_>... invocations)
       : name_(name), invocations_(invocations...) {}
+
+  template <typename ReturnT_, typename ParamsT_,
+            std::enable_if_t<std::is_base_of_v<ParamsBase, ParamsT_>, int> = 0>
+  constexpr Method(const char* name, Final, ReturnT_ return_type,
+                   ParamsT_ params)
+      : name_(name),
+        invocations_(Overload{return_type, params}),
+        is_final_(true) {}
+
+  constexpr Method(const char* name, Final,
+                   Overload<Returns, Params_>... invocations)
+      : name_(name), invocations_(invocations...), is_final_(true) {}
 };
 
 // CTAD for Non-overloaded form.
@@ -72,6 +88,19 @@ template <typename... Returns, typename... Params>
 Method(const char*, Overload<Returns, Params>...)
     -> Method<std::tuple<Returns...>, std::tuple<Params...>>;
 
+// CTAD for Final Non-overloaded form.
+template <
+    typename ReturnT, typename ParamsT,
+    typename = std::enable_if_t<!std::is_base_of_v<OverloadBase, ReturnT> &&
+                                !std::is_base_of_v<OverloadBase, ParamsT>>>
+Method(const char*, Final, ReturnT, ParamsT)
+    -> Method<std::tuple<ReturnT>, std::tuple<ParamsT>>;
+
+// CTAD for Final Overloaded form.
+template <typename... Returns, typename... Params>
+Method(const char*, Final, Overload<Returns, Params>...)
+    -> Method<std::tuple<Returns...>, std::tuple<Params...>>;
+
 template <typename ReturnT1, typename ParamsT1, typename ReturnT2,
           typename ParamsT2>
 constexpr bool operator==(const Method<ReturnT1, ParamsT1>& lhs,
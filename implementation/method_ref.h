@@ -17,6 +17,7 @@
 #ifndef JNI_BIND_METHOD_REF_H
 #define JNI_BIND_METHOD_REF_H
 
+#include <array>
 #include <mutex>
 #include <tuple>
 #include <utility>
@@ -28,6 +29,7 @@
 #include "implementation/jni_helper/invoke_static.h"
 #include "implementation/jni_helper/jni_env.h"
 #include "implementation/jni_helper/jni_helper.h"
+#include "implementation/jni_helper/jvalue.h"
 #include "implementation/jni_helper/lifecycle_object.h"
 #include "implementation/jni_type.h"
 #include "implementation/method.h"
@@ -41,6 +43,7 @@
 #include "implementation/signature.h"
 #include "implementation/void.h"
 #include "jni_dep.h"
+#include "metaprogramming/concurrent_registry.h"
 #include "metaprogramming/double_locked_value.h"
 #include "metaprogramming/invocable_map.h"
 #include "metaprogramming/optional_wrap.h"
@@ -48,13 +51,6 @@
 
 namespace jni {
 
-// See JvmRef::~JvmRef.
-static inline auto& GetDefaultLoadedMethodList() {
-  static auto* ret_val =
-      new std::vector<metaprogramming::DoubleLockedValue<jmethodID>*>{};
-  return *ret_val;
-}
-
 template <typename IdT_, IdType kReturnIDType>
 struct OverloadRef {
   using IdT = IdT_;
@@ -65,11 +61,7 @@ struct OverloadRef {
   static jmethodID GetMethodID(jclass clazz) {
     static jni::metaprogramming::DoubleLockedValue<jmethodID> return_value;
 
-    return return_value.LoadAndMaybeInit([=]() {
-      if constexpr (IdT_::JniT::GetClassLoader() == kDefaultClassLoader) {
-        GetDefaultLoadedMethodList().push_back(&return_value);
-      }
-
+    auto resolve = [=]() {
       if constexpr (IdT::kIsStatic) {
         return jni::JniHelper::GetStaticMethodID(clazz, IdT::Name(),
                                                  Signature_v<IdT>.data());
@@ -77,7 +69,18 @@ struct OverloadRef {
         return jni::JniHelper::GetMethodID(clazz, IdT::Name(),
                                            Signature_v<IdT>.data());
       }
-    });
+    };
+
+    if constexpr (IdT_::JniT::GetClassLoader() == kDefaultClassLoader) {
+      return return_value.LoadAndMaybeInit([=]() {
+        GetDefaultLoadedMethodList().Register(&return_value);
+        return resolve();
+      });
+    } else {
+      // Each loader instance has its own jclass, and so its own IDs.
+      return ClassRef_t<typename IdT_::JniT>::LoadAndMaybeInitId(
+          clazz, return_value, resolve);
+    }
   }
 
   template <typename... Params>
@@ -87,7 +90,13 @@ struct OverloadRef {
     constexpr bool kStatic = ReturnIdT::kIsStatic;
     const jmethodID mthd = OverloadRef::GetMethodID(clazz);
 
-    if constexpr (std::is_same_v<ReturnProxied, void>) {
+    if constexpr (IdT::kIsJValueArgs) {
+      return InvokeA(std::index_sequence_for<Params...>{}, clazz, object, mthd,
+                     std::forward<Params>(params)...);
+    } else if constexpr (IdT::kIsFinal) {
+      return InvokeNonvirtual(clazz, object, mthd,
+                              std::forward<Params>(params)...);
+    } else if constexpr (std::is_same_v<ReturnProxied, void>) {
       return InvokeHelper<void, kRank, kStatic>::Invoke(
           object, clazz, mthd,
           Proxy_t<Params>::ProxyAsArg(std::forward<Params>(params))...);
@@ -103,6 +112,71 @@ struct OverloadRef {
               Proxy_t<Params>::ProxyAsArg(std::forward<Params>(params))...));
     }
   }
+
+ private:
+  // Invokes an instance method of a |Final| method or class through
+  // CallNonvirtual<Type>Method, bypassing virtual dispatch.
+  template <typename... Params>
+  static ReturnProxied InvokeNonvirtual(jclass clazz, jobject object,
+                                        jmethodID mthd, Params&&... params) {
+    constexpr std::size_t kRank = ReturnIdT::kRank;
+
+    if constexpr (std::is_same_v<ReturnProxied, void>) {
+      return InvokeHelper<void, kRank, false>::InvokeNonvirtual(
+          object, clazz, mthd,
+          Proxy_t<Params>::ProxyAsArg(std::forward<Params>(params))...);
+    } else {
+      return static_cast<ReturnProxied>(
+          InvokeHelper<typename ReturnIdT::CDecl, kRank, false>::
+              InvokeNonvirtual(object, clazz, mthd,
+                               Proxy_t<Params>::ProxyAsArg(
+                                   std::forward<Params>(params))...));
+    }
+  }
+
+  // Packs params as their declared types into a jvalue array and invokes the
+  // "A" variant of the JNI call (see |JValueArgs|).
+  //
+  // The array is built in the same full expression as the call so that any
+  // temporaries backing the args (e.g. container arrays) outlive it.
+  template <std::size_t... Is, typename... Params>
+  static ReturnProxied InvokeA(std::index_sequence<Is...>, jclass clazz,
+                               jobject object, jmethodID mthd,
+                               Params&&... params) {
+    // Trailing element avoids a zero length array for nullary methods.
+    return InvokeWithJValues(
+        clazz, object, mthd,
+        std::array<jvalue, sizeof...(Params) + 1>{
+            ToJValue<typename ReturnIdT::template ChangeIdx<2, Is>::CDecl>(
+                Proxy_t<Params>::ProxyAsArg(std::forward<Params>(params)))...}
+            .data());
+  }
+
+  static ReturnProxied InvokeWithJValues(jclass clazz, jobject object,
+                                         jmethodID mthd, const jvalue* args) {
+    constexpr std::size_t kRank = ReturnIdT::kRank;
+    constexpr bool kStatic = ReturnIdT::kIsStatic;
+
+    if constexpr (std::is_same_v<ReturnProxied, void> && IdT::kIsFinal) {
+      return InvokeHelper<void, kRank, false>::InvokeNonvirtualA(object, clazz,
+                                                                 mthd, args);
+    } else if constexpr (std::is_same_v<ReturnProxied, void>) {
+      return InvokeHelper<void, kRank, kStatic>::InvokeA(object, clazz, mthd,
+                                                         args);
+    } else if constexpr (IdT::kIsConstructor) {
+      return ReturnProxied{
+          LifecycleHelper<jobject, LifecycleType::LOCAL>::ConstructA(
+              clazz, mthd, args)};
+    } else if constexpr (IdT::kIsFinal) {
+      return static_cast<ReturnProxied>(
+          InvokeHelper<typename ReturnIdT::CDecl, kRank, false>::
+              InvokeNonvirtualA(object, clazz, mthd, args));
+    } else {
+      return static_cast<ReturnProxied>(
+          InvokeHelper<typename ReturnIdT::CDecl, kRank, kStatic>::InvokeA(
+              object, clazz, mthd, args));
+    }
+  }
 };
 
 }  // namespace jni
@@ -24,6 +24,8 @@ namespace {
 using ::jni::AdoptGlobal;
 using ::jni::Array;
 using ::jni::Class;
+using ::jni::Constructor;
+using ::jni::Final;
 using ::jni::GlobalObject;
 using ::jni::Id;
 using ::jni::IdType;
@@ -32,10 +34,14 @@ using ::jni::kDefaultClassLoader;
 using ::jni::LocalArray;
 using ::jni::LocalObject;
 using ::jni::Method;
+using ::jni::Overload;
 using ::jni::OverloadRef;
 using ::jni::Params;
 using ::jni::Rank;
 using ::jni::Return;
+using ::jni::Static;
+using ::jni::StaticRef;
+using ::jni::test::AsGlobal;
 using ::jni::test::Fake;
 using ::jni::test::JniTest;
 using ::testing::_;
@@ -294,4 +300,70 @@ TEST_F(JniTest, MethodRef_SupportsArrays) {
   obj1("Foo", local_array);
 }
 
+TEST_F(JniTest, MethodRef_FinalMethodsUseNonvirtualDispatch) {
+  static constexpr Class kClass2{"kClass2"};
+  static constexpr Class kClass{
+      "kClass",
+      Method{"Virtual", Return<jint>{}, Params<>{}},
+      Method{"Final", Final{}, Return<jint>{}, Params<jint>{}},
+      Method{"FinalOverloaded", Final{},
+             Overload{Return<void>{}, Params<>{}},
+             Overload{Return{kClass2}, Params<jfloat>{}}},
+  };
+
+  EXPECT_CALL(*env_, CallIntMethodV(Fake<jobject>(), _, _));
+  EXPECT_CALL(*env_, CallNonvirtualIntMethodV(
+                         Fake<jobject>(), AsGlobal(Fake<jclass>()), _, _))
+      .WillOnce(testing::Return(123));
+  EXPECT_CALL(*env_, CallNonvirtualVoidMethodV(
+                         Fake<jobject>(), AsGlobal(Fake<jclass>()), _, _));
+  EXPECT_CALL(*env_, CallNonvirtualObjectMethodV(
+                         Fake<jobject>(), AsGlobal(Fake<jclass>()), _, _));
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  obj("Virtual");
+  EXPECT_EQ(obj("Final", 1), 123);
+  obj("FinalOverloaded");
+  obj("FinalOverloaded", 1.f);
+}
+
+TEST_F(JniTest, MethodRef_FinalClassesUseNonvirtualDispatch) {
+  static constexpr Class kClass{
+      "kClass",
+      Final{},
+      Constructor<jint>{},
+      Static{Method{"StaticFoo", Return<jint>{}, Params<>{}}},
+      Method{"Foo", Return<jint>{}, Params<>{}},
+      Method{"Bar", Return{Array<jint>{}}, Params<>{}},
+  };
+
+  // Constructors and static methods are unaffected.
+  EXPECT_CALL(*env_, NewObjectV(_, _, _));
+  EXPECT_CALL(*env_, CallStaticIntMethodV);
+  EXPECT_CALL(*env_, CallIntMethodV).Times(0);
+  EXPECT_CALL(*env_,
+              CallNonvirtualIntMethodV(_, AsGlobal(Fake<jclass>()), _, _));
+  EXPECT_CALL(*env_,
+              CallNonvirtualObjectMethodV(_, AsGlobal(Fake<jclass>()), _, _));
+
+  LocalObject<kClass> obj{1};
+  obj("Foo");
+  obj("Bar");
+  StaticRef<kClass>{}("StaticFoo");
+}
+
+TEST_F(JniTest, MethodRef_FinalCanBeAddedToAnExistingDefinition) {
+  static constexpr Class kVirtualClass{
+      "kClass", Method{"Foo", Return<jint>{}, Params<>{}}};
+  static constexpr decltype(kVirtualClass) kFinalClass{Final{},
+                                                       kVirtualClass};
+
+  EXPECT_CALL(*env_, CallIntMethodV(Fake<jobject>(1), _, _));
+  EXPECT_CALL(*env_, CallNonvirtualIntMethodV(Fake<jobject>(2),
+                                              AsGlobal(Fake<jclass>()), _, _));
+
+  LocalObject<kVirtualClass>{Fake<jobject>(1)}("Foo");
+  LocalObject<kFinalClass>{Fake<jobject>(2)}("Foo");
+}
+
 }  // namespace
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef JNI_BIND_IMPLEMENTATION_PREWARM_H_
+#define JNI_BIND_IMPLEMENTATION_PREWARM_H_
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include "implementation/class_ref.h"
+#include "implementation/default_class_loader.h"
+#include "implementation/field_ref.h"
+#include "implementation/id.h"
+#include "implementation/id_type.h"
+#include "implementation/jni_helper/jni_env.h"
+#include "implementation/method_ref.h"
+#include "implementation/no_idx.h"
+#include "jni_dep.h"
+
+namespace jni {
+
+// Resolves every jmethodID and jfieldID described by the static definition of
+// |JniT| (constructors, methods, static methods, fields and static fields)
+// ahead of their first use.
+//
+// IDs are stored in exactly the same caches that |ObjectRef| and |StaticRef|
+// use, so |JniT| must match the type of the objects that will later be used
+// (e.g. `JniT<jobject, kClass>` for `LocalObject<kClass>`).
+//
+// Lookups that fail (e.g. the implicit default constructor of a class that
+// doesn't have one) have their pending exception cleared and are left
+// uncached, so they will be retried (and fail as usual) on first real use.
+template <typename JniT>
+struct Prewarmer {
+  static constexpr std::size_t kNumMethods =
+      std::tuple_size_v<std::decay_t<decltype(JniT::stripped_class_v.methods_)>>;
+  static constexpr std::size_t kNumFields =
+      std::tuple_size_v<std::decay_t<decltype(JniT::stripped_class_v.fields_)>>;
+  static constexpr std::size_t kNumStaticMethods =
+      std::tuple_size_v<std::decay_t<decltype(JniT::static_v.methods_)>>;
+  static constexpr std::size_t kNumStaticFields =
+      std::tuple_size_v<std::decay_t<decltype(JniT::static_v.fields_)>>;
+
+  // Resolves the jclass through the default class loader then all IDs.
+  // Returns the loaded jclass (or nullptr if the class couldn't be found).
+  static jclass PrewarmClassAndIds() {
+    static_assert(JniT::GetClassLoader() == kDefaultClassLoader,
+                  "Only default loaded classes can be found without a loader "
+                  "instance, use ClassLoaderRef::Prewarm instead.");
+
+    jclass clazz = ClassRef_t<JniT>::GetAndMaybeLoadClassRef(nullptr);
+    ClearFailedLookup(clazz);
+
+    if (clazz != nullptr) {
+      PrewarmIds(clazz);
+    }
+
+    return clazz;
+  }
+
+  // Resolves all IDs for an already loaded |clazz|.
+  static void PrewarmIds(jclass clazz) {
+    // Constructors.
+    PrewarmOverloadSet<IdType::OVERLOAD_SET, IdType::OVERLOAD,
+                       IdType::OVERLOAD_PARAM, kNoIdx>(clazz);
+
+    PrewarmOverloadSets<IdType::OVERLOAD_SET, IdType::OVERLOAD,
+                        IdType::OVERLOAD_PARAM>(
+        clazz, std::make_index_sequence<kNumMethods>());
+    PrewarmOverloadSets<IdType::STATIC_OVERLOAD_SET, IdType::STATIC_OVERLOAD,
+                        IdType::STATIC_OVERLOAD_PARAM>(
+        clazz, std::make_index_sequence<kNumStaticMethods>());
+
+    PrewarmFields<IdType::FIELD>(clazz, std::make_index_sequence<kNumFields>());
+    PrewarmFields<IdType::STATIC_FIELD>(
+        clazz, std::make_index_sequence<kNumStaticFields>());
+  }
+
+ private:
+  template <typename T>
+  static void ClearFailedLookup(T id) {
+    if (id == nullptr && JniEnv::GetEnv()->ExceptionCheck()) {
+      JniEnv::GetEnv()->ExceptionClear();
+    }
+  }
+
+  template <IdType kOverloadType, IdType kParamType, std::size_t I,
+            std::size_t... Js>
+  static void PrewarmOverloads(jclass clazz, std::index_sequence<Js...>) {
+    (ClearFailedLookup(
+         OverloadRef<Id<JniT, kOverloadType, I, Js>, kParamType>::GetMethodID(
+             clazz)),
+     ...);
+  }
+
+  template <IdType kSetType, IdType kOverloadType, IdType kParamType,
+            std::size_t I>
+  static void PrewarmOverloadSet(jclass clazz) {
+    PrewarmOverloads<kOverloadType, kParamType, I>(
+        clazz, std::make_index_sequence<Id<JniT, kSetType, I>::kNumParams>());
+  }
+
+  template <IdType kSetType, IdType kOverloadType, IdType kParamType,
+            std::size_t... Is>
+  static void PrewarmOverloadSets(jclass clazz, std::index_sequence<Is...>) {
+    (PrewarmOverloadSet<kSetType, kOverloadType, kParamType, Is>(clazz), ...);
+  }
+
+  template <IdType kFieldType, std::size_t... Is>
+  static void PrewarmFields(jclass clazz, std::index_sequence<Is...>) {
+    (ClearFailedLookup(FieldRef<JniT, kFieldType, Is>::GetFieldID(clazz)),
+     ...);
+  }
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_PREWARM_H_
@@ -0,0 +1,178 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Class;
+using ::jni::ClassLoader;
+using ::jni::Constructor;
+using ::jni::Field;
+using ::jni::Jvm;
+using ::jni::JvmRef;
+using ::jni::kNullClassLoader;
+using ::jni::LocalClassLoader;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Overload;
+using ::jni::Params;
+using ::jni::Return;
+using ::jni::Static;
+using ::jni::StaticRef;
+using ::jni::SupportedClassSet;
+using ::jni::test::Fake;
+using ::jni::test::JniTest;
+using ::jni::test::JniTestWithNoDefaultJvmRef;
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::InSequence;
+using ::testing::StrEq;
+
+static constexpr Class kClass{
+    "kClass",
+    Constructor<jint>{},
+    Static{
+        Method{"StaticFoo", Return<jint>{}, Params{}},
+        Field{"staticBar", jint{}},
+    },
+    Method{"Foo", Return{}, Params<jint>{}},
+    Method{"Baz", Overload{Return{}, Params{}},
+           Overload{Return{}, Params<jfloat>{}}},
+    Field{"bar", jint{}},
+};
+
+TEST_F(JniTest, Prewarm_ResolvesAllIdsOnce) {
+  EXPECT_CALL(*env_, FindClass(StrEq("kClass"))).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("<init>"), StrEq("(I)V"))).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), StrEq("(I)V"))).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Baz"), StrEq("()V"))).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Baz"), StrEq("(F)V"))).Times(1);
+  EXPECT_CALL(*env_, GetStaticMethodID(_, StrEq("StaticFoo"), StrEq("()I")))
+      .WillOnce(::testing::Return(Fake<jmethodID>()));
+  EXPECT_CALL(*env_, GetFieldID(_, StrEq("bar"), StrEq("I"))).Times(1);
+  EXPECT_CALL(*env_, GetStaticFieldID(_, StrEq("staticBar"), StrEq("I")))
+      .WillOnce(::testing::Return(Fake<jfieldID>()));
+
+  default_jvm_ref_->Prewarm<kClass>();
+
+  // Subsequent use doesn't query any IDs.
+  LocalObject<kClass> obj{123};
+  obj("Foo", 1);
+  obj("Baz");
+  obj("Baz", 1.f);
+  obj["bar"].Get();
+  StaticRef<kClass>{}("StaticFoo");
+  StaticRef<kClass>{}["staticBar"].Get();
+}
+
+TEST_F(JniTest, Prewarm_ClearsExceptionsForMissingIds) {
+  static constexpr Class kMissingClass{"kMissingClass",
+                                       Method{"Foo", Return{}, Params{}}};
+
+  // Implicit default constructor is missing from the Java definition.
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("<init>"), StrEq("()V")))
+      .WillOnce(::testing::Return(nullptr));
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), StrEq("()V")));
+
+  {
+    InSequence seq;
+    EXPECT_CALL(*env_, ExceptionCheck).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*env_, ExceptionClear).Times(1);
+  }
+
+  default_jvm_ref_->Prewarm<kMissingClass>();
+}
+
+TEST_F(JniTest, Prewarm_SkipsIdsForMissingClass) {
+  static constexpr Class kNotFoundClass{"kNotFoundClass",
+                                        Method{"Foo", Return{}, Params{}}};
+
+  EXPECT_CALL(*env_, FindClass(StrEq("kNotFoundClass")))
+      .WillOnce(::testing::Return(nullptr));
+  EXPECT_CALL(*env_, NewGlobalRef(nullptr))
+      .WillOnce(::testing::Return(nullptr));
+  EXPECT_CALL(*env_, ExceptionCheck).WillOnce(::testing::Return(true));
+  EXPECT_CALL(*env_, ExceptionClear).Times(1);
+  EXPECT_CALL(*env_, GetMethodID).Times(0);
+
+  default_jvm_ref_->Prewarm<kNotFoundClass>();
+}
+
+TEST_F(JniTest, Prewarm_SupportsMultipleClasses) {
+  static constexpr Class kClass1{"kClass1", Method{"Foo", Return{}, Params{}}};
+  static constexpr Class kClass2{"kClass2", Method{"Foo", Return{}, Params{}}};
+
+  EXPECT_CALL(*env_, GetMethodID).Times(AnyNumber());
+  EXPECT_CALL(*env_, FindClass(StrEq("kClass1"))).Times(1);
+  EXPECT_CALL(*env_, FindClass(StrEq("kClass2"))).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), StrEq("()V"))).Times(2);
+
+  default_jvm_ref_->Prewarm<kClass1, kClass2>();
+}
+
+TEST_F(JniTest, Prewarm_RunsOnBackgroundThread) {
+  static constexpr Class kBackgroundClass{"kBackgroundClass",
+                                          Method{"Foo", Return{}, Params{}}};
+
+  EXPECT_CALL(*env_, GetMethodID).Times(AnyNumber());
+  EXPECT_CALL(*env_, FindClass(StrEq("kBackgroundClass"))).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), StrEq("()V"))).Times(1);
+
+  default_jvm_ref_->PrewarmOnBackgroundThread<kBackgroundClass>().join();
+
+  LocalObject<kBackgroundClass> obj{};
+  obj("Foo");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Class loaders.
+////////////////////////////////////////////////////////////////////////////////
+static constexpr Class kLoadedClass{"kLoadedClass",
+                                    Method{"Foo", Return{}, Params{}},
+                                    Field{"bar", jint{}}};
+
+static constexpr ClassLoader kClassLoader{kNullClassLoader,
+                                          SupportedClassSet{kLoadedClass}};
+
+static constexpr Jvm kJvm{kClassLoader};
+
+TEST_F(JniTestWithNoDefaultJvmRef, Prewarm_ClassLoaderResolvesAllIdsOnce) {
+  JvmRef<kJvm> jvm_ref{jvm_.get()};
+
+  ON_CALL(*env_, CallObjectMethodV)
+      .WillByDefault(::testing::Return(Fake<jclass>()));
+
+  EXPECT_CALL(*env_, GetMethodID).Times(AnyNumber());
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), StrEq("()V"))).Times(1);
+  EXPECT_CALL(*env_, GetFieldID(_, StrEq("bar"), StrEq("I"))).Times(1);
+
+  LocalClassLoader<kClassLoader, kJvm> local_class_loader{Fake<jobject>()};
+  local_class_loader.Prewarm<kLoadedClass>();
+
+  auto obj = local_class_loader.BuildLocalObject<kLoadedClass>();
+  obj("Foo");
+  obj["bar"].Get();
+
+  TearDown();
+}
+
+}  // namespace
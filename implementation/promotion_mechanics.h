@@ -16,6 +16,8 @@
 #ifndef JNI_BIND_IMPLEMENTATION_PROMOTION_MECHANICS_H_
 #define JNI_BIND_IMPLEMENTATION_PROMOTION_MECHANICS_H_
 
+#include <cstdint>
+
 #include "implementation/forward_declarations.h"
 #include "implementation/jni_helper/jni_helper.h"
 #include "implementation/jni_helper/lifecycle.h"
@@ -157,17 +159,33 @@ struct Entry<LifecycleType::GLOBAL, JniT, ScopedTerminalTag>
   using Base::Base;
 };
 
+// Records the |FrameOwnedLocals| scope a local wrapper was created in, so that
+// locals of enclosing frames aren't left to it (empty for globals).
+template <LifecycleType lifecycleType>
+struct CreationScope {};
+
+template <>
+struct CreationScope<LifecycleType::LOCAL> {
+  const std::uint64_t created_in_ = FrameOwnedLocalsState::CurrentId();
+};
+
 // Local augmentation.
 template <LifecycleType lifecycleType, typename JniT, typename... ViableSpans>
 struct Scoped
-    : public Entry<lifecycleType, JniT, ViableSpans..., ScopedTerminalTag> {
+    : public Entry<lifecycleType, JniT, ViableSpans..., ScopedTerminalTag>,
+      private CreationScope<lifecycleType> {
   using Base = Entry<lifecycleType, JniT, ViableSpans..., ScopedTerminalTag>;
   using Base::Base;
 
   ~Scoped() {
     if (Base::object_ref_) {
-      LifecycleHelper<typename JniT::StorageType, lifecycleType>::Delete(
-          Base::object_ref_);
+      if constexpr (lifecycleType == LifecycleType::LOCAL) {
+        LifecycleHelper<typename JniT::StorageType, lifecycleType>::Delete(
+            Base::object_ref_, CreationScope<lifecycleType>::created_in_);
+      } else {
+        LifecycleHelper<typename JniT::StorageType, lifecycleType>::Delete(
+            Base::object_ref_);
+      }
     }
   }
 };
@@ -17,6 +17,7 @@
 #ifndef JNI_BIND_TYPE_PROXY_H_
 #define JNI_BIND_TYPE_PROXY_H_
 
+#include <iterator>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -55,9 +56,46 @@ using AllKeys =
              jobjectArray, jintArray, jbooleanArray, jbyteArray, jcharArray,
              jshortArray, jdoubleArray, jfloatArray, jlongArray>;
 
+// Key for contiguous C++ containers of primitives (e.g. std::vector<jint>,
+// std::array<jfloat, 4>, jdouble[3]) passed as Java primitive arrays.
+template <typename SpanType>
+struct ContainerArgTag {};
+
+// Maps contiguous containers of primitives to their |ContainerArgTag|, and
+// leaves all other types (including objects like |DirectBuffer|) unchanged.
+template <typename T, typename Enable = void>
+struct ContainerArgKey {
+  using type = T;
+};
+
+template <typename T>
+struct ContainerArgKey<
+    T, std::void_t<decltype(std::data(std::declval<const T&>())),
+                   decltype(std::size(std::declval<const T&>()))>> {
+  using SpanType = std::remove_cv_t<
+      std::remove_pointer_t<decltype(std::data(std::declval<const T&>()))>>;
+
+  static constexpr bool kIsPrimitive =
+      std::is_same_v<SpanType, jboolean> || std::is_same_v<SpanType, jbyte> ||
+      std::is_same_v<SpanType, jchar> || std::is_same_v<SpanType, jshort> ||
+      std::is_same_v<SpanType, jint> || std::is_same_v<SpanType, jlong> ||
+      std::is_same_v<SpanType, jfloat> || std::is_same_v<SpanType, jdouble>;
+
+  using type = std::conditional_t<
+      kIsPrimitive && !std::is_constructible_v<jobject, const T&>,
+      ContainerArgTag<SpanType>, T>;
+};
+
+template <typename T>
+using ContainerArgKey_t = typename ContainerArgKey<T>::type;
+
+template <typename T>
+static constexpr bool kIsContainerArg =
+    !std::is_same_v<ContainerArgKey_t<T>, T>;
+
 template <typename TUndecayed>
 struct ProxyHelper {
-  using T = std::decay_t<TUndecayed>;
+  using T = ContainerArgKey_t<std::decay_t<TUndecayed>>;
 
   // Metafunction that builds a list of a passable type to all it's possible
   // passable types, which may not be the same.  E.g. jint => jint, but
@@ -155,6 +155,13 @@ struct Proxy<JObject,
         std::string_view{class_v.name_} == std::string_view{IdT::Val().name_};
   };
 
+  // DirectBuffer (always a java.nio.ByteBuffer).
+  template <typename IdT, typename T>
+  struct ContextualViabilityHelper<IdT, DirectBuffer<T>> {
+    static constexpr bool kViable = std::string_view{IdT::Val().name_} ==
+                                    std::string_view{"java/nio/ByteBuffer"};
+  };
+
   template <typename IdT, typename T>
   static constexpr bool kViable = ContextualViabilityHelper<IdT, T>::kViable;
 
@@ -16,6 +16,10 @@
 #ifndef JNI_BIND_IMPLEMENTATION_PROXY_DEFINITIONS_ARRAY_H_
 #define JNI_BIND_IMPLEMENTATION_PROXY_DEFINITIONS_ARRAY_H_
 
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+
 #include "implementation/default_class_loader.h"
 #include "implementation/jvm.h"
 #include "implementation/name_constants.h"
@@ -30,6 +34,14 @@ template <typename SpanType, std::size_t kRank, const auto& class_v_,
           const auto& class_loader_v_, const auto& jvm_v_>
 class LocalArray;
 
+// Owns the temporary Java array built for a container argument.
+template <typename SpanType>
+struct ContainerArgStorage {
+  std::optional<LocalArray<SpanType, 1, kNoClassSpecified, kDefaultClassLoader,
+                           kDefaultJvm>>
+      array;
+};
+
 template <typename JArrayType>
 struct Proxy<JArrayType, typename std::enable_if_t<
                              std::is_convertible_v<JArrayType, jarray>>>
@@ -61,23 +73,42 @@ struct Proxy<JArrayType, typename std::enable_if_t<
          (std::string_view{class_v_.name_} == NameOrNothing_v<param_copy>));
   };
 
+  // Contiguous containers of primitives (e.g. std::vector<jint>).
+  template <typename ParamSelection, typename T>
+  struct Helper<ParamSelection, T, std::enable_if_t<kIsContainerArg<T>>> {
+    static constexpr bool val =
+        ParamSelection::kRank == 1 &&
+        std::is_same_v<ContainerArgKey_t<T>, ContainerArgTag<CDecl>>;
+  };
+
   template <typename ParamSelection, typename T>
   static constexpr bool kViable = Helper<ParamSelection, T>::val;
 
   using AsDecl = std::tuple<ArrayTag<JArrayType>>;
-  using AsArg =
-      std::tuple<JArrayType, RefBaseTag<JArrayType>, ArrayTag<JArrayType>>;
+  using AsArg = std::tuple<JArrayType, RefBaseTag<JArrayType>,
+                           ArrayTag<JArrayType>, ContainerArgTag<CDecl>>;
 
   template <typename Id>
   using AsReturn = typename ArrayHelper<Id>::AsReturn;
 
   static JArrayType ProxyAsArg(JArrayType arr) { return arr; };
 
-  template <typename T>
+  template <typename T, typename = std::enable_if_t<!kIsContainerArg<T>>>
   static JArrayType ProxyAsArg(const T& t) {
     return JArrayType{t};
   };
 
+  // Copies a container into a temporary Java array with a single region call.
+  //
+  // |storage| is a default argument, so it is destroyed (and the local array
+  // deleted) at the end of the full expression making the JNI call.
+  template <typename T, typename = std::enable_if_t<kIsContainerArg<T>>>
+  static JArrayType ProxyAsArg(
+      const T& container,
+      ContainerArgStorage<CDecl>&& storage = ContainerArgStorage<CDecl>{}) {
+    return static_cast<JArrayType>(storage.array.emplace(container));
+  };
+
   template <typename T, typename = std::enable_if_t<
                             std::is_base_of_v<RefBaseTag<JArrayType>, T>>>
   static JArrayType ProxyAsArg(T&& t) {
@@ -18,12 +18,14 @@
 
 #include <iterator>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
 #include "class_defs/java_lang_classes.h"
 #include "implementation/default_class_loader.h"
 #include "implementation/jni_helper/lifecycle_string.h"
 #include "implementation/jvm.h"
+#include "implementation/literal.h"
 #include "implementation/proxy.h"
 #include "implementation/ref_base.h"
 
@@ -51,8 +53,10 @@ struct Proxy<JString,
     using type = LocalString;
   };
 
-  using AsArg = std::tuple<std::string, jstring, char*, const char*,
-                           std::string_view, RefBaseTag<jstring>>;
+  using AsArg =
+      std::tuple<std::string, jstring, char*, const char*, std::string_view,
+                 const char16_t*, std::u16string, std::u16string_view,
+                 RefBaseTag<jstring>, LiteralTag>;
 
   template <typename Id>
   using AsReturn = typename Helper<Id, Id::kRank>::type;
@@ -64,27 +68,48 @@ struct Proxy<JString,
       IsConvertibleKey<T>::template value<char*> ||
       IsConvertibleKey<T>::template value<const char*> ||
       IsConvertibleKey<T>::template value<std::string_view> ||
+      IsConvertibleKey<T>::template value<const char16_t*> ||
+      IsConvertibleKey<T>::template value<std::u16string> ||
+      IsConvertibleKey<T>::template value<std::u16string_view> ||
+      IsConvertibleKey<T>::template value<LiteralTag> ||
       std::is_same_v<T, LocalString> || std::is_same_v<T, GlobalString>;
 
   // These leak local instances of strings.  Usually, RAII mechanisms would
   // correctly release local instances, but here we are stripping that so it can
-  // be used in a method.  This could be obviated by wrapping the calling scope
-  // in a local stack frame.
+  // be used in a method.  Wrap the calling scope in a |LocalFrame| to release
+  // them (e.g. in long running loops).
   static jstring ProxyAsArg(jstring s) { return s; }
 
   template <typename T,
-            typename = std::enable_if_t<std::is_same_v<T, const char*> ||
-                                        std::is_same_v<T, std::string> ||
-                                        std::is_same_v<T, std::string_view>>>
+            typename = std::enable_if_t<
+                std::is_same_v<T, const char*> ||
+                std::is_same_v<T, std::string> ||
+                std::is_same_v<T, std::string_view> ||
+                std::is_same_v<T, const char16_t*> ||
+                std::is_same_v<T, std::u16string> ||
+                std::is_same_v<T, std::u16string_view>>>
   static jstring ProxyAsArg(T s) {
     if constexpr (std::is_same_v<T, const char*>) {
       return LifecycleHelper<jstring, LifecycleType::LOCAL>::Construct(s);
+    } else if constexpr (std::is_same_v<T, const char16_t*> ||
+                         std::is_same_v<T, std::u16string> ||
+                         std::is_same_v<T, std::u16string_view>) {
+      // UTF-16 is passed with |NewString|, which needs no transcoding.
+      return LifecycleHelper<jstring, LifecycleType::LOCAL>::Construct(
+          std::u16string_view{s});
     } else {
       return LifecycleHelper<jstring, LifecycleType::LOCAL>::Construct(
           s.data());
     }
   }
 
+  // Interned, so nothing is leaked.
+  template <typename T,
+            typename = std::enable_if_t<std::is_base_of_v<LiteralTag, T>>>
+  static jstring ProxyAsArg(const T&) {
+    return T::Get();
+  }
+
   template <typename T,
             typename = std::enable_if_t<std::is_same_v<T, GlobalString> ||
                                         std::is_same_v<T, LocalString>>>
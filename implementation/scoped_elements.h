@@ -0,0 +1,141 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_SCOPED_ELEMENTS_H_
+#define JNI_BIND_IMPLEMENTATION_SCOPED_ELEMENTS_H_
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+
+#include "implementation/jni_helper/jni_array_helper.h"
+#include "implementation/jni_helper/jni_helper.h"
+#include "implementation/jni_helper/lifecycle.h"
+#include "jni_dep.h"
+
+namespace jni {
+
+// Iterable range over an object array (or array of rank > 1) which yields
+// scoped |LocalObject|s (or |LocalArray|s) instead of raw references.
+//
+// The iterator holds a single element at a time, releasing the previous one
+// as it advances.  Iterating a large |Object[]| therefore uses a single local
+// reference, where |ArrayView| leaves one behind per element.
+//
+//   for (auto& obj : arr.Elements()) { obj("Foo"); }
+//
+// Elements may be moved out of the loop to be kept, in which case
+// |capacity_chunk| can be set to call |EnsureLocalCapacity| once per chunk of
+// elements.  If capacity can't be reserved, iteration ends early with an
+// OutOfMemoryError pending.
+//
+// |ElementT| is constructed from the raw element (a jobject, or a jarray for
+// arrays of rank > 1).
+template <typename ElementT, std::size_t kRank>
+class ScopedElements {
+ public:
+  using RawElementT = std::conditional_t<(kRank > 1), jarray, jobject>;
+
+  class Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = ElementT;
+    using pointer = ElementT*;
+    using reference = ElementT&;
+
+    Iterator(jobjectArray array, std::size_t idx, std::size_t size,
+             std::size_t capacity_chunk)
+        : array_(array),
+          idx_(idx),
+          size_(size),
+          capacity_chunk_(capacity_chunk) {
+      MaybeReserveChunk();
+    }
+
+    // Fetched lazily so that |end()| and unvisited elements cost nothing.
+    ElementT& operator*() {
+      if (!element_) {
+        element_.emplace(static_cast<RawElementT>(
+            JniArrayHelper<jobject, kRank>::GetArrayElement(array_, idx_)));
+      }
+
+      return *element_;
+    }
+
+    ElementT* operator->() { return &**this; }
+
+    // Releases the current element (unless it was moved from).  It is deleted
+    // directly, even under |FrameOwnedLocals|, which would otherwise keep one
+    // local per element alive until the frame is popped.
+    Iterator& operator++() {
+      if (element_) {
+        LifecycleHelper<jobject, LifecycleType::LOCAL>::DeleteImmediately(
+            static_cast<jobject>(element_->Release()));
+        element_.reset();
+      }
+      ++idx_;
+      MaybeReserveChunk();
+      return *this;
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) {
+      return lhs.array_ == rhs.array_ && lhs.idx_ == rhs.idx_;
+    }
+
+    friend bool operator!=(const Iterator& lhs, const Iterator& rhs) {
+      return !(lhs == rhs);
+    }
+
+   private:
+    // Reserves capacity at the start of each chunk.  On failure no further
+    // JNI calls may be made, so the iterator skips to the end.
+    void MaybeReserveChunk() {
+      if (capacity_chunk_ == 0 || idx_ >= size_ ||
+          idx_ % capacity_chunk_ != 0) {
+        return;
+      }
+
+      if (!JniHelper::EnsureLocalCapacity(
+              static_cast<jint>(capacity_chunk_))) {
+        idx_ = size_;
+      }
+    }
+
+    const jobjectArray array_;
+    std::size_t idx_;
+    const std::size_t size_;
+    const std::size_t capacity_chunk_;
+    std::optional<ElementT> element_;
+  };
+
+  ScopedElements(jobjectArray array, std::size_t size,
+                 std::size_t capacity_chunk = 0)
+      : array_(array), size_(size), capacity_chunk_(capacity_chunk) {}
+
+  Iterator begin() { return Iterator{array_, 0, size_, capacity_chunk_}; }
+  Iterator end() { return Iterator{array_, size_, size_, capacity_chunk_}; }
+
+ private:
+  const jobjectArray array_;
+  const std::size_t size_;
+  const std::size_t capacity_chunk_;
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_SCOPED_ELEMENTS_H_
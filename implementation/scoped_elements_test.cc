@@ -0,0 +1,132 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Class;
+using ::jni::LocalArray;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::Return;
+using ::jni::test::Fake;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::InSequence;
+
+static constexpr Class kClass{"kClass", Method{"Foo", Return{}, Params{}}};
+
+TEST_F(JniTest, ScopedElements_ReleasesEachObjectBeforeFetchingTheNext) {
+  EXPECT_CALL(*env_, GetArrayLength(Fake<jobjectArray>()))
+      .WillOnce(::testing::Return(3));
+  EXPECT_CALL(*env_, DeleteLocalRef(_)).Times(AnyNumber());
+  EXPECT_CALL(*env_, EnsureLocalCapacity).Times(0);
+
+  InSequence seq;
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_CALL(*env_, GetObjectArrayElement(Fake<jobjectArray>(), i))
+        .WillOnce(::testing::Return(Fake<jobject>(i + 1)));
+    EXPECT_CALL(*env_, CallVoidMethodV(Fake<jobject>(i + 1), _, _));
+    EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(i + 1)));
+  }
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobjectArray>()));
+
+  LocalArray<jobject, 1, kClass> arr{Fake<jobjectArray>()};
+  for (auto& obj : arr.Elements()) {
+    obj("Foo");
+  }
+}
+
+TEST_F(JniTest, ScopedElements_YieldsLocalArraysForHigherRanks) {
+  EXPECT_CALL(*env_, GetArrayLength(Fake<jobjectArray>()))
+      .WillOnce(::testing::Return(2));
+  EXPECT_CALL(*env_, GetObjectArrayElement(Fake<jobjectArray>(), 0))
+      .WillOnce(::testing::Return(Fake<jintArray>(1)));
+  EXPECT_CALL(*env_, GetObjectArrayElement(Fake<jobjectArray>(), 1))
+      .WillOnce(::testing::Return(Fake<jintArray>(2)));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jintArray>(1)));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jintArray>(2)));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobjectArray>()));
+
+  LocalArray<jint, 2> arr{Fake<jobjectArray>()};
+  std::vector<jintArray> rows;
+  for (auto& row : arr.Elements()) {
+    rows.push_back(static_cast<jintArray>(row));
+  }
+
+  EXPECT_EQ(rows, (std::vector{Fake<jintArray>(1), Fake<jintArray>(2)}));
+}
+
+TEST_F(JniTest, ScopedElements_MovedElementsAreKeptWithChunkedCapacity) {
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(::testing::Return(5));
+  EXPECT_CALL(*env_, GetObjectArrayElement)
+      .WillRepeatedly(::testing::Return(Fake<jobject>()));
+  EXPECT_CALL(*env_, EnsureLocalCapacity(2))
+      .Times(3)
+      .WillRepeatedly(::testing::Return(JNI_OK));
+  EXPECT_CALL(*env_, DeleteLocalRef(_)).Times(AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>())).Times(5);
+
+  LocalArray<jobject, 1, kClass> arr{Fake<jobjectArray>()};
+  std::vector<LocalObject<kClass>> kept;
+  for (auto& obj : arr.Elements(2)) {
+    kept.push_back(std::move(obj));
+  }
+  EXPECT_EQ(kept.size(), 5);
+}
+
+TEST_F(JniTest, ScopedElements_StopsIfCapacityCannotBeReserved) {
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(::testing::Return(5));
+  EXPECT_CALL(*env_, GetObjectArrayElement)
+      .WillRepeatedly(::testing::Return(Fake<jobject>()));
+  EXPECT_CALL(*env_, EnsureLocalCapacity(2))
+      .WillOnce(::testing::Return(JNI_OK))
+      .WillOnce(::testing::Return(JNI_ERR));
+  EXPECT_CALL(*env_, DeleteLocalRef(_)).Times(AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>())).Times(2);
+
+  LocalArray<jobject, 1, kClass> arr{Fake<jobjectArray>()};
+  std::vector<LocalObject<kClass>> kept;
+  for (auto& obj : arr.Elements(2)) {
+    kept.push_back(std::move(obj));
+  }
+  EXPECT_EQ(kept.size(), 2);
+}
+
+TEST_F(JniTest, ScopedElements_StringArraysYieldLocalStrings) {
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(::testing::Return(1));
+  EXPECT_CALL(*env_, GetObjectArrayElement(Fake<jobjectArray>(), 0))
+      .WillOnce(::testing::Return(Fake<jstring>()));
+  EXPECT_CALL(*env_, DeleteLocalRef(_)).Times(AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jstring>()));
+
+  LocalArray<jstring> arr{Fake<jobjectArray>()};
+  for (auto& str : arr.Elements()) {
+    EXPECT_EQ(static_cast<jobject>(str), Fake<jstring>());
+  }
+}
+
+}  // namespace
@@ -0,0 +1,140 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_SHARED_GLOBAL_OBJECT_H_
+#define JNI_BIND_IMPLEMENTATION_SHARED_GLOBAL_OBJECT_H_
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "implementation/default_class_loader.h"
+#include "implementation/global_object.h"
+#include "implementation/jni_helper/global_ref_deletion_queue.h"
+#include "implementation/jni_helper/jni_env.h"
+#include "implementation/jvm.h"
+#include "jni_dep.h"
+
+namespace jni {
+
+// Reference counted |GlobalObject| which can be cheaply shared between many
+// owners (and threads).
+//
+// Copying a |GlobalObject| (with |CreateCopy|) calls |NewGlobalRef|, which on
+// HotSpot takes a VM-wide lock.  Copies of a |SharedGlobalObject| instead share
+// a single global reference and only touch an atomic count, and the global
+// reference is deleted exactly once, when the last owner is destroyed.
+//
+//   SharedGlobalObject<kClass> shared{PromoteToGlobal{}, local_jobject};
+//   std::thread worker{[shared] { (*shared)("Foo"); }};
+//
+// The last owner may be destroyed on a thread that has never used JNI (or after
+// the |JvmRef| is gone).  Rather than attaching it, the global reference is
+// then handed to |GlobalRefDeletionQueue| for an attached thread to delete.
+template <const auto& class_v_,
+          const auto& class_loader_v_ = kDefaultClassLoader,
+          const auto& jvm_v_ = kDefaultJvm>
+class SharedGlobalObject {
+ public:
+  using GlobalT = GlobalObject<class_v_, class_loader_v_, jvm_v_>;
+
+  // Empty, no Java object is constructed.
+  SharedGlobalObject() = default;
+  SharedGlobalObject(std::nullptr_t) {}
+
+  // Builds the shared |GlobalObject| from |vals| (e.g. a |GlobalObject| to be
+  // moved from, |AdoptGlobal| or |PromoteToGlobal| and a jobject, or
+  // constructor arguments).
+  template <typename T, typename... Ts,
+            typename = std::enable_if_t<
+                !std::is_same_v<std::decay_t<T>, SharedGlobalObject> &&
+                !std::is_same_v<std::decay_t<T>, std::nullptr_t>>>
+  explicit SharedGlobalObject(T&& val, Ts&&... vals)
+      : control_block_(new ControlBlock{std::forward<T>(val),
+                                        std::forward<Ts>(vals)...}) {}
+
+  SharedGlobalObject(const SharedGlobalObject& rhs)
+      : control_block_(rhs.control_block_) {
+    if (control_block_) {
+      // Nothing is published by taking a reference, so relaxed suffices.
+      control_block_->count_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  SharedGlobalObject(SharedGlobalObject&& rhs)
+      : control_block_(std::exchange(rhs.control_block_, nullptr)) {}
+
+  SharedGlobalObject& operator=(SharedGlobalObject rhs) {
+    std::swap(control_block_, rhs.control_block_);
+    return *this;
+  }
+
+  ~SharedGlobalObject() { Reset(); }
+
+  // Drops this owner's reference (deleting the global if it was the last).
+  void Reset() {
+    ControlBlock* control_block = std::exchange(control_block_, nullptr);
+    if (control_block &&
+        control_block->count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      Destroy(control_block);
+    }
+  }
+
+  GlobalT& operator*() const { return control_block_->global_; }
+  GlobalT* operator->() const { return &control_block_->global_; }
+
+  explicit operator bool() const { return control_block_ != nullptr; }
+
+  explicit operator jobject() const {
+    return control_block_ ? static_cast<jobject>(control_block_->global_)
+                          : nullptr;
+  }
+
+  // Number of owners sharing the global reference (0 if empty).  Only a hint
+  // if other threads hold owners.
+  std::size_t UseCount() const {
+    return control_block_
+               ? control_block_->count_.load(std::memory_order_relaxed)
+               : 0;
+  }
+
+ private:
+  struct ControlBlock {
+    template <typename... Ts>
+    explicit ControlBlock(Ts&&... vals) : global_(std::forward<Ts>(vals)...) {}
+
+    std::atomic<std::size_t> count_{1};
+    GlobalT global_;
+  };
+
+  static void Destroy(ControlBlock* control_block) {
+    if (JniEnv::GetEnv() == nullptr) {
+      if (jobject object =
+              static_cast<jobject>(control_block->global_.Release())) {
+        GlobalRefDeletionQueue::Enqueue(object);
+      }
+    }
+
+    delete control_block;
+  }
+
+  ControlBlock* control_block_ = nullptr;
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_SHARED_GLOBAL_OBJECT_H_
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::AdoptGlobal;
+using ::jni::Class;
+using ::jni::GlobalObject;
+using ::jni::GlobalRefDeletionQueue;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::PromoteToGlobal;
+using ::jni::SharedGlobalObject;
+using ::jni::test::AsGlobal;
+using ::jni::test::Fake;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::Return;
+
+static constexpr Class kClass{"kClass",
+                              Method{"Foo", jni::Return{}, Params{}}};
+
+TEST_F(JniTest, SharedGlobalObject_CopiesWithoutNewGlobalRef) {
+  EXPECT_CALL(*env_, NewGlobalRef).Times(0);
+  EXPECT_CALL(*env_, DeleteGlobalRef(Fake<jobject>()));
+
+  SharedGlobalObject<kClass> shared{AdoptGlobal{}, Fake<jobject>()};
+  EXPECT_EQ(shared.UseCount(), 1);
+
+  {
+    SharedGlobalObject<kClass> copy_1{shared};
+    SharedGlobalObject<kClass> copy_2 = copy_1;
+    EXPECT_EQ(shared.UseCount(), 3);
+    EXPECT_EQ(static_cast<jobject>(copy_2), Fake<jobject>());
+  }
+
+  EXPECT_EQ(shared.UseCount(), 1);
+}
+
+TEST_F(JniTest, SharedGlobalObject_PromotesAndInvokesMethods) {
+  // The jclass is promoted (once) too.
+  EXPECT_CALL(*env_, NewGlobalRef).Times(AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef).Times(AnyNumber());
+  EXPECT_CALL(*env_, NewGlobalRef(Fake<jobject>()));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>()));
+  EXPECT_CALL(*env_, CallVoidMethodV(AsGlobal(Fake<jobject>()), _, _))
+      .Times(2);
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jobject>())));
+
+  SharedGlobalObject<kClass> shared{PromoteToGlobal{}, Fake<jobject>()};
+  SharedGlobalObject<kClass> copy{shared};
+  (*shared)("Foo");
+  (*copy)("Foo");
+}
+
+TEST_F(JniTest, SharedGlobalObject_TakesOwnershipOfGlobalObjects) {
+  EXPECT_CALL(*env_, DeleteGlobalRef(Fake<jobject>()));
+
+  GlobalObject<kClass> global{AdoptGlobal{}, Fake<jobject>()};
+  SharedGlobalObject<kClass> shared{std::move(global)};
+  EXPECT_EQ(static_cast<jobject>(global), nullptr);
+  EXPECT_EQ(static_cast<jobject>(*shared), Fake<jobject>());
+}
+
+TEST_F(JniTest, SharedGlobalObject_MovesAndAssigns) {
+  EXPECT_CALL(*env_, DeleteGlobalRef(Fake<jobject>(1)));
+  EXPECT_CALL(*env_, DeleteGlobalRef(Fake<jobject>(2)));
+
+  SharedGlobalObject<kClass> shared_1{AdoptGlobal{}, Fake<jobject>(1)};
+  SharedGlobalObject<kClass> shared_2{AdoptGlobal{}, Fake<jobject>(2)};
+
+  SharedGlobalObject<kClass> moved{std::move(shared_1)};
+  EXPECT_FALSE(shared_1);
+  EXPECT_EQ(moved.UseCount(), 1);
+
+  // The last owner of |Fake<jobject>(1)| is replaced.
+  moved = shared_2;
+  EXPECT_EQ(shared_2.UseCount(), 2);
+
+  moved.Reset();
+  EXPECT_EQ(moved.UseCount(), 0);
+  EXPECT_EQ(shared_2.UseCount(), 1);
+}
+
+TEST_F(JniTest, SharedGlobalObject_IsSharedAcrossThreads) {
+  EXPECT_CALL(*env_, DeleteGlobalRef(Fake<jobject>()));
+
+  SharedGlobalObject<kClass> shared{AdoptGlobal{}, Fake<jobject>()};
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([shared] {
+      for (int j = 0; j < 1000; ++j) {
+        SharedGlobalObject<kClass> copy{shared};
+      }
+    });
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(shared.UseCount(), 1);
+}
+
+TEST_F(JniTest, SharedGlobalObject_QueuesDeletionFromUnattachedLastOwner) {
+  EXPECT_CALL(*jvm_, GetEnv).Times(0);
+  EXPECT_CALL(*jvm_, AttachCurrentThread).Times(0);
+  EXPECT_CALL(*env_, DeleteGlobalRef(Fake<jobject>())).Times(0);
+
+  SharedGlobalObject<kClass> shared{AdoptGlobal{}, Fake<jobject>()};
+  const std::size_t depth = GlobalRefDeletionQueue::Depth();
+
+  // The worker has never used JNI, so it has no cached JNIEnv.
+  std::thread worker{[shared{std::move(shared)}]() mutable { shared.Reset(); }};
+  worker.join();
+  EXPECT_EQ(GlobalRefDeletionQueue::Depth(), depth + 1);
+
+  ::testing::Mock::VerifyAndClearExpectations(env_.get());
+  EXPECT_CALL(*env_, DeleteGlobalRef(Fake<jobject>()));
+  EXPECT_EQ(GlobalRefDeletionQueue::Drain(), depth + 1);
+}
+
+}  // namespace
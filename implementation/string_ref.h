@@ -17,6 +17,8 @@
 #ifndef JNI_BIND_STRING_REF_H_
 #define JNI_BIND_STRING_REF_H_
 
+#include <cstddef>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -90,6 +92,138 @@ class UtfStringView {
   const char *chars_;
 };
 
+// Represents a UTF-16 view into a jstring (see jni::LocalString::PinUtf16()).
+//
+// UTF-16 is Java's native representation, so unlike |UtfStringView| this is
+// usually a direct view of the string's contents with no transcoding.  When
+// |critical| is set, GetStringCritical is used, which makes a copy even less
+// likely, but no JNI calls may be made while the view is alive.
+class Utf16StringView {
+ public:
+  explicit Utf16StringView(jstring java_string, bool critical = false)
+      : java_string_(java_string),
+        critical_(critical),
+        length_(java_string_ ? JniHelper::GetStringLength(java_string_) : 0),
+        chars_(!java_string_ ? nullptr
+               : critical_   ? JniHelper::GetStringCritical(java_string_)
+                             : JniHelper::GetStringChars(java_string_)) {}
+
+  ~Utf16StringView() {
+    if (!chars_) {
+      return;
+    }
+
+    if (critical_) {
+      JniHelper::ReleaseStringCritical(java_string_, chars_);
+    } else {
+      JniHelper::ReleaseStringChars(java_string_, chars_);
+    }
+  }
+
+  Utf16StringView(Utf16StringView &&) = delete;
+  Utf16StringView(const Utf16StringView &) = delete;
+
+  // Returns a view into the pinned UTF-16 code units (not null terminated).
+  std::u16string_view ToString() const {
+    if (!chars_) {
+      return {};
+    }
+
+    return {reinterpret_cast<const char16_t *>(chars_), length_};
+  }
+
+ private:
+  const jstring java_string_;
+  const bool critical_;
+
+  // Fetched before pinning, as no JNI calls are allowed in a critical region.
+  const std::size_t length_;
+  const jchar *chars_;
+};
+
+// Copies of a jstring into caller provided memory (see LocalString::CopyUtf).
+//
+// Unlike |UtfStringView|, these use Get<UTF>StringRegion which write straight
+// into the destination, so nothing is allocated on either side of the JNI
+// boundary.  Null strings are treated as empty.
+struct StringRegion {
+  // Returns the length of |java_string| in modified UTF-8 bytes (excluding the
+  // null terminator).  Like snprintf, |buf| is only written if the string and
+  // its terminator fit, i.e. if the returned length is less than |buf_size|.
+  static std::size_t CopyUtf(jstring java_string, char *buf,
+                             std::size_t buf_size) {
+    const std::size_t utf_length = UtfLength(java_string);
+    if (utf_length < buf_size) {
+      CopyUtf(java_string, utf_length, buf);
+    }
+
+    return utf_length;
+  }
+
+  // Returns the length of |java_string| in UTF-16 code units.  |buf| is only
+  // written if the whole string fits.  No terminator is written.
+  static std::size_t CopyUtf16(jstring java_string, jchar *buf,
+                               std::size_t buf_size) {
+    const std::size_t length =
+        java_string ? JniHelper::GetStringLength(java_string) : 0;
+    if (length != 0 && length <= buf_size) {
+      JniHelper::GetStringRegion(java_string, 0, static_cast<jsize>(length),
+                                 buf);
+    }
+
+    return length;
+  }
+
+  static std::size_t UtfLength(jstring java_string) {
+    return java_string ? JniHelper::GetStringUTFLength(java_string) : 0;
+  }
+
+  // Writes |utf_length| bytes and a null terminator to |buf|.
+  static void CopyUtf(jstring java_string, std::size_t utf_length, char *buf) {
+    if (utf_length != 0) {
+      JniHelper::GetStringUTFRegion(
+          java_string, 0, JniHelper::GetStringLength(java_string), buf);
+    }
+
+    buf[utf_length] = '\0';
+  }
+};
+
+// Modified UTF-8 copy of a jstring which is stored inline if it is shorter
+// than |kInlineSize| bytes, and on the heap otherwise.
+//
+// Short strings therefore cost no allocation and no pinning:
+//
+//   InlineUtfString<> str = local_string.ReadUtf();
+//   std::string_view sv = str.ToString();
+template <std::size_t kInlineSize = 64>
+class InlineUtfString {
+ public:
+  static_assert(kInlineSize > 0, "Room is needed for the null terminator.");
+
+  explicit InlineUtfString(jstring java_string)
+      : size_(StringRegion::UtfLength(java_string)) {
+    if (size_ >= kInlineSize) {
+      heap_.reset(new char[size_ + 1]);
+    }
+
+    StringRegion::CopyUtf(java_string, size_,
+                          heap_ ? heap_.get() : inline_);
+  }
+
+  // Null terminated.
+  const char *data() const { return heap_ ? heap_.get() : inline_; }
+  std::size_t size() const { return size_; }
+  bool IsInline() const { return !heap_; }
+
+  std::string_view ToString() const { return {data(), size_}; }
+
+ private:
+  std::size_t size_;
+  std::unique_ptr<char[]> heap_;
+  char inline_[kInlineSize];
+};
+
 }  // namespace jni
 
 #endif  // JNI_BIND_STRING_REF_H_
@@ -24,13 +24,18 @@ using ::jni::AdoptGlobal;
 using ::jni::CreateCopy;
 using ::jni::GlobalObject;
 using ::jni::GlobalString;
+using ::jni::InlineUtfString;
 using ::jni::kJavaLangString;
 using ::jni::LocalObject;
 using ::jni::LocalString;
+using ::jni::Utf16StringView;
 using ::jni::UtfStringView;
 using ::jni::test::Fake;
 using ::jni::test::JniTest;
 using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::InSequence;
+using ::testing::SetArrayArgument;
 using ::testing::Return;
 using ::testing::StrEq;
 
@@ -153,6 +158,131 @@ TEST_F(JniTest, LocalString_AllowsRValueLocalString) {
   obj("TakesStrParam", LocalString{"abcde"});
 }
 
+TEST_F(JniTest, LocalString_CopiesUtfIntoCallerBuffer) {
+  EXPECT_CALL(*env_, GetStringUTFLength(Fake<jstring>())).WillOnce(Return(5));
+  EXPECT_CALL(*env_, GetStringLength(Fake<jstring>())).WillOnce(Return(5));
+  EXPECT_CALL(*env_, GetStringUTFRegion(Fake<jstring>(), 0, 5, _))
+      .WillOnce(SetArrayArgument<3>(char_ptr, char_ptr + 5));
+  EXPECT_CALL(*env_, GetStringUTFChars).Times(0);
+
+  LocalString str{Fake<jstring>()};
+  char buf[8];
+  EXPECT_EQ(str.CopyUtf(buf, sizeof(buf)), 5);
+  EXPECT_STREQ(buf, "TestS");
+}
+
+TEST_F(JniTest, LocalString_CopyUtfDoesNotWriteIfBufferIsTooSmall) {
+  EXPECT_CALL(*env_, GetStringUTFLength(Fake<jstring>())).WillOnce(Return(5));
+  EXPECT_CALL(*env_, GetStringUTFRegion).Times(0);
+
+  LocalString str{Fake<jstring>()};
+  char buf[5] = "abc";
+  EXPECT_EQ(str.CopyUtf(buf, sizeof(buf)), 5);
+  EXPECT_STREQ(buf, "abc");
+}
+
+TEST_F(JniTest, LocalString_CopiesUtf16IntoCallerBuffer) {
+  const jchar chars[] = {'a', 'b', 'c'};
+  EXPECT_CALL(*env_, GetStringLength(Fake<jstring>())).WillOnce(Return(3));
+  EXPECT_CALL(*env_, GetStringRegion(Fake<jstring>(), 0, 3, _))
+      .WillOnce(SetArrayArgument<3>(chars, chars + 3));
+
+  LocalString str{Fake<jstring>()};
+  jchar buf[4] = {};
+  EXPECT_EQ(str.CopyUtf16(buf, 4), 3);
+  EXPECT_EQ(buf[2], 'c');
+}
+
+TEST_F(JniTest, LocalString_ReadsShortStringsInline) {
+  EXPECT_CALL(*env_, GetStringUTFLength).WillOnce(Return(10));
+  EXPECT_CALL(*env_, GetStringLength).WillOnce(Return(10));
+  EXPECT_CALL(*env_, GetStringUTFRegion(Fake<jstring>(), 0, 10, _))
+      .WillOnce(SetArrayArgument<3>(char_ptr, char_ptr + 10));
+
+  LocalString str{Fake<jstring>()};
+  InlineUtfString<> utf = str.ReadUtf();
+  EXPECT_TRUE(utf.IsInline());
+  EXPECT_EQ(utf.ToString(), "TestString");
+}
+
+TEST_F(JniTest, LocalString_ReadsLongStringsOnTheHeap) {
+  EXPECT_CALL(*env_, GetStringUTFLength).WillOnce(Return(10));
+  EXPECT_CALL(*env_, GetStringLength).WillOnce(Return(10));
+  EXPECT_CALL(*env_, GetStringUTFRegion(Fake<jstring>(), 0, 10, _))
+      .WillOnce(SetArrayArgument<3>(char_ptr, char_ptr + 10));
+
+  LocalString str{Fake<jstring>()};
+  InlineUtfString<4> utf = str.ReadUtf<4>();
+  EXPECT_FALSE(utf.IsInline());
+  EXPECT_EQ(utf.ToString(), "TestString");
+  EXPECT_EQ(utf.data()[10], '\0');
+}
+
+TEST_F(JniTest, LocalString_ReadsNullAsEmpty) {
+  EXPECT_CALL(*env_, GetStringUTFLength).Times(0);
+
+  LocalString str{nullptr};
+  EXPECT_EQ(str.ReadUtf().ToString(), "");
+}
+
+TEST_F(JniTest, LocalString_CreatesFromUtf16WithNewString) {
+  EXPECT_CALL(*env_, NewString(_, 3)).WillOnce(Return(Fake<jstring>()));
+  EXPECT_CALL(*env_, NewStringUTF).Times(0);
+  EXPECT_CALL(*env_, GetMethodID).Times(0);
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jstring>()));
+
+  LocalString str{std::u16string_view{u"abc"}};
+  EXPECT_EQ(static_cast<jstring>(str), Fake<jstring>());
+}
+
+TEST_F(JniTest, LocalString_PinsUtf16) {
+  const jchar chars[] = {'a', 'b', 'c'};
+  EXPECT_CALL(*env_, GetStringLength(Fake<jstring>())).WillOnce(Return(3));
+  EXPECT_CALL(*env_, GetStringChars(Fake<jstring>(), nullptr))
+      .WillOnce(Return(chars));
+  EXPECT_CALL(*env_, ReleaseStringChars(Fake<jstring>(), chars));
+  EXPECT_CALL(*env_, GetStringUTFChars).Times(0);
+
+  LocalString str{Fake<jstring>()};
+  Utf16StringView view = str.PinUtf16();
+  EXPECT_EQ(view.ToString(), u"abc");
+}
+
+TEST_F(JniTest, LocalString_PinsUtf16Critical) {
+  const jchar chars[] = {'a', 'b'};
+  InSequence seq;
+  EXPECT_CALL(*env_, GetStringLength(Fake<jstring>())).WillOnce(Return(2));
+  EXPECT_CALL(*env_, GetStringCritical(Fake<jstring>(), nullptr))
+      .WillOnce(Return(chars));
+  EXPECT_CALL(*env_, ReleaseStringCritical(Fake<jstring>(), chars));
+
+  LocalString str{Fake<jstring>()};
+  Utf16StringView view = str.PinUtf16(/*critical=*/true);
+  EXPECT_EQ(view.ToString(), u"ab");
+}
+
+TEST_F(JniTest, LocalString_PinsNullUtf16AsEmpty) {
+  EXPECT_CALL(*env_, GetStringChars).Times(0);
+  EXPECT_CALL(*env_, ReleaseStringChars).Times(0);
+
+  LocalString str{nullptr};
+  EXPECT_TRUE(str.PinUtf16().ToString().empty());
+}
+
+TEST_F(JniTest, LocalString_PassesUtf16ArgumentsWithNewString) {
+  EXPECT_CALL(*env_, NewString(_, 5))
+      .Times(4)
+      .WillRepeatedly(Return(Fake<jstring>()));
+  EXPECT_CALL(*env_, NewStringUTF).Times(0);
+
+  LocalObject<kClass> obj{};
+  obj("TakesStrParam", std::u16string_view{u"abcde"});
+  obj("TakesStrParam", std::u16string{u"abcde"});
+  obj("TakesStrParam", u"abcde");
+  const char16_t* ptr = u"abcde";
+  obj("TakesStrParam", ptr);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Global String Tests.
 ////////////////////////////////////////////////////////////////////////////////
@@ -229,4 +359,27 @@ TEST_F(JniTest, GlobalString_AllowsRValueGlobalString) {
   obj("TakesStrParam", GlobalString{"abcde"});
 }
 
+TEST_F(JniTest, GlobalString_CopiesUtfIntoCallerBuffer) {
+  EXPECT_CALL(*env_, GetStringUTFLength(Fake<jstring>())).WillOnce(Return(4));
+  EXPECT_CALL(*env_, GetStringLength(Fake<jstring>())).WillOnce(Return(4));
+  EXPECT_CALL(*env_, GetStringUTFRegion(Fake<jstring>(), 0, 4, _))
+      .WillOnce(SetArrayArgument<3>(char_ptr, char_ptr + 4));
+
+  GlobalString str{AdoptGlobal{}, Fake<jstring>()};
+  char buf[8];
+  EXPECT_EQ(str.CopyUtf(buf, sizeof(buf)), 4);
+  EXPECT_STREQ(buf, "Test");
+}
+
+TEST_F(JniTest, GlobalString_CreatesFromUtf16WithNewString) {
+  EXPECT_CALL(*env_, NewString(_, 3)).WillOnce(Return(Fake<jstring>(1)));
+  EXPECT_CALL(*env_, NewGlobalRef(Fake<jstring>(1)))
+      .WillOnce(Return(Fake<jstring>(2)));
+  EXPECT_CALL(*env_, DeleteLocalRef(_)).Times(AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jstring>(1)));
+  EXPECT_CALL(*env_, DeleteGlobalRef(Fake<jstring>(2)));
+
+  GlobalString str{std::u16string{u"abc"}};
+}
+
 }  // namespace
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_TRACKED_ARRAY_VIEW_H_
+#define JNI_BIND_IMPLEMENTATION_TRACKED_ARRAY_VIEW_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "implementation/jni_helper/jni_array_helper.h"
+#include "jni_dep.h"
+
+namespace jni {
+
+// Pinned view of a primitive rank 1 array which only writes back the parts
+// that were modified.
+//
+// Releasing an |ArrayView| with write-back makes the VM copy the entire
+// buffer, even if a handful of elements changed.  A |TrackedArrayView| instead
+// records writes in a bitmap of |chunk_size| element chunks and on release
+// copies each run of dirty chunks with Set<Type>ArrayRegion, then releases
+// with JNI_ABORT.  Sparse updates therefore cost proportional to what changed.
+//
+// Writes must go through |Set| or be declared with |MarkDirty|, otherwise they
+// may be discarded:
+//
+//   TrackedArrayView<jfloat> view = arr.PinTracked();
+//   view.Set(17, 1.f);
+//   std::fill_n(view.ptr() + 4096, 64, 0.f);
+//   view.MarkDirty(4096, 64);
+template <typename SpanType>
+class TrackedArrayView {
+ public:
+  static_assert(!std::is_same_v<SpanType, jobject> &&
+                    !std::is_same_v<SpanType, jstring>,
+                "Only primitive arrays can track writes.");
+
+  static constexpr std::size_t kDefaultChunkSize = 1024;
+
+  TrackedArrayView(TrackedArrayView&&) = delete;
+  TrackedArrayView(const TrackedArrayView&) = delete;
+
+  TrackedArrayView(jarray array, std::size_t size,
+                   std::size_t chunk_size = kDefaultChunkSize)
+      : array_(array),
+        get_array_elements_result_(
+            JniArrayHelper<SpanType, 1>::GetArrayElements(array)),
+        size_(size),
+        chunk_size_(std::max<std::size_t>(chunk_size, 1)),
+        dirty_chunks_((size + chunk_size_ - 1) / chunk_size_, false) {}
+
+  ~TrackedArrayView() {
+    SpanType* const data = get_array_elements_result_.ptr_;
+
+    // Writes to a direct (non-copy) pointer are already visible to Java.
+    if (get_array_elements_result_.is_copy == JNI_TRUE) {
+      std::size_t chunk = 0;
+      while (chunk < dirty_chunks_.size()) {
+        if (!dirty_chunks_[chunk]) {
+          ++chunk;
+          continue;
+        }
+
+        const std::size_t run_start = chunk;
+        while (chunk < dirty_chunks_.size() && dirty_chunks_[chunk]) {
+          ++chunk;
+        }
+
+        const std::size_t start = run_start * chunk_size_;
+        const std::size_t end = std::min(chunk * chunk_size_, size_);
+        JniArrayHelper<SpanType, 1>::SetArrayRegion(array_, start, end - start,
+                                                    data + start);
+      }
+    }
+
+    JniArrayHelper<SpanType, 1>::ReleaseArrayElements(array_, data, JNI_ABORT);
+  }
+
+  // Writes through this pointer must be declared with |MarkDirty|.
+  SpanType* ptr() { return get_array_elements_result_.ptr_; }
+  std::size_t size() const { return size_; }
+
+  SpanType operator[](std::size_t idx) const {
+    return get_array_elements_result_.ptr_[idx];
+  }
+
+  void Set(std::size_t idx, SpanType val) {
+    assert(idx < size_);
+    get_array_elements_result_.ptr_[idx] = val;
+    dirty_chunks_[idx / chunk_size_] = true;
+  }
+
+  // Declares |len| elements starting at |offset| as modified.
+  void MarkDirty(std::size_t offset, std::size_t len) {
+    assert(offset <= size_ && len <= size_ - offset);
+    if (len == 0) {
+      return;
+    }
+
+    const std::size_t last_chunk = (offset + len - 1) / chunk_size_;
+    for (std::size_t chunk = offset / chunk_size_; chunk <= last_chunk;
+         ++chunk) {
+      dirty_chunks_[chunk] = true;
+    }
+  }
+
+  const SpanType* begin() const { return get_array_elements_result_.ptr_; }
+  const SpanType* end() const {
+    return get_array_elements_result_.ptr_ + size_;
+  }
+
+ private:
+  const jarray array_;
+  const GetArrayElementsResult<SpanType> get_array_elements_result_;
+  const std::size_t size_;
+  const std::size_t chunk_size_;
+  std::vector<bool> dirty_chunks_;
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_TRACKED_ARRAY_VIEW_H_
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <array>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::LocalArray;
+using ::jni::TrackedArrayView;
+using ::jni::test::Fake;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::DoAll;
+using ::testing::InSequence;
+using ::testing::SetArgPointee;
+
+TEST_F(JniTest, TrackedArrayView_ReleasesUnmodifiedWithoutCopying) {
+  std::array<jint, 8> vals{};
+
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(::testing::Return(8));
+  EXPECT_CALL(*env_, GetIntArrayElements)
+      .WillOnce(::testing::Return(vals.data()));
+  EXPECT_CALL(*env_, SetIntArrayRegion).Times(0);
+  EXPECT_CALL(*env_, ReleaseIntArrayElements(Fake<jintArray>(), vals.data(),
+                                             JNI_ABORT));
+
+  LocalArray<jint> arr{Fake<jintArray>()};
+  TrackedArrayView<jint> view = arr.PinTracked(2);
+  EXPECT_EQ(view.size(), 8);
+  EXPECT_EQ(view[3], 0);
+}
+
+TEST_F(JniTest, TrackedArrayView_WritesBackOnlyDirtyChunks) {
+  std::array<jfloat, 10> vals{};
+
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(::testing::Return(10));
+  EXPECT_CALL(*env_, GetFloatArrayElements)
+      .WillOnce(::testing::Return(vals.data()));
+
+  InSequence seq;
+  EXPECT_CALL(*env_, SetFloatArrayRegion(Fake<jfloatArray>(), 0, 3,
+                                         vals.data()));
+  EXPECT_CALL(*env_, SetFloatArrayRegion(Fake<jfloatArray>(), 6, 4,
+                                         vals.data() + 6));
+  EXPECT_CALL(*env_, ReleaseFloatArrayElements(Fake<jfloatArray>(),
+                                               vals.data(), JNI_ABORT));
+
+  LocalArray<jfloat> arr{Fake<jfloatArray>()};
+  TrackedArrayView<jfloat> view = arr.PinTracked(3);
+  view.Set(1, 5.f);
+
+  // Spans chunks [6, 9) and the trailing partial chunk [9, 10).
+  std::fill_n(view.ptr() + 7, 3, 1.f);
+  view.MarkDirty(7, 3);
+
+  EXPECT_EQ(vals[1], 5.f);
+  EXPECT_EQ(vals[9], 1.f);
+}
+
+TEST_F(JniTest, TrackedArrayView_CoalescesAdjacentChunks) {
+  std::array<jlong, 8> vals{};
+
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(::testing::Return(8));
+  EXPECT_CALL(*env_, GetLongArrayElements)
+      .WillOnce(::testing::Return(vals.data()));
+  EXPECT_CALL(*env_, SetLongArrayRegion(Fake<jlongArray>(), 2, 4,
+                                        vals.data() + 2));
+
+  LocalArray<jlong> arr{Fake<jlongArray>()};
+  TrackedArrayView<jlong> view = arr.PinTracked(2);
+  view.Set(2, 1);
+  view.Set(5, 1);
+  view.MarkDirty(4, 0);
+}
+
+TEST_F(JniTest, TrackedArrayView_SkipsWriteBackForDirectPointers) {
+  std::array<jdouble, 4> vals{};
+
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(::testing::Return(4));
+  EXPECT_CALL(*env_, GetDoubleArrayElements(Fake<jdoubleArray>(), _))
+      .WillOnce(DoAll(SetArgPointee<1>(JNI_FALSE),
+                      ::testing::Return(vals.data())));
+  EXPECT_CALL(*env_, SetDoubleArrayRegion).Times(0);
+  EXPECT_CALL(*env_, ReleaseDoubleArrayElements(Fake<jdoubleArray>(),
+                                                vals.data(), JNI_ABORT));
+
+  LocalArray<jdouble> arr{Fake<jdoubleArray>()};
+  TrackedArrayView<jdouble> view = arr.PinTracked();
+  view.Set(0, 2.);
+  EXPECT_EQ(vals[0], 2.);
+}
+
+#ifndef NDEBUG
+TEST_F(JniTest, TrackedArrayView_AssertsOnOutOfBoundsWrites) {
+  EXPECT_DEATH(
+      {
+        LocalArray<jint> arr{Fake<jintArray>()};
+        TrackedArrayView<jint> view = arr.PinTracked(2);
+        view.Set(view.size(), 1);
+      },
+      "idx < size_");
+  EXPECT_DEATH(
+      {
+        LocalArray<jint> arr{Fake<jintArray>()};
+        TrackedArrayView<jint> view = arr.PinTracked(2);
+        view.MarkDirty(view.size(), 1);
+      },
+      "len <= size_ - offset");
+}
+#endif  // NDEBUG
+
+}  // namespace
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_WEAK_OBJECT_H_
+#define JNI_BIND_IMPLEMENTATION_WEAK_OBJECT_H_
+
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "implementation/default_class_loader.h"
+#include "implementation/global_object.h"
+#include "implementation/jni_helper/jni_env.h"
+#include "implementation/jni_helper/lifecycle.h"
+#include "implementation/jvm.h"
+#include "implementation/local_object.h"
+#include "implementation/ref_base.h"
+#include "jni_dep.h"
+
+namespace jni {
+
+// Weak global reference to an object of |class_v_|.
+//
+// Unlike |GlobalObject|, a |WeakObject| doesn't prevent its referent from
+// being garbage collected, which makes it suitable for caches (e.g. of
+// listeners) that shouldn't extend the lifetime of what they hold.
+//
+// Methods can't be invoked on a |WeakObject| directly, as the referent may be
+// collected at any time.  Instead, |Lock| returns a |LocalObject| which keeps
+// the referent alive while in scope:
+//
+//   WeakObject<kListener> weak{listener};
+//   if (auto listener = weak.Lock()) {
+//     (*listener)("onEvent");
+//   }
+template <const auto& class_v_,
+          const auto& class_loader_v_ = kDefaultClassLoader,
+          const auto& jvm_v_ = kDefaultJvm>
+class WeakObject {
+ public:
+  using LifecycleT = LifecycleHelper<jobject, LifecycleType::WEAK>;
+  using LocalT = LocalObject<class_v_, class_loader_v_, jvm_v_>;
+
+  WeakObject() = default;
+  WeakObject(std::nullptr_t) {}
+
+  // Creates a new weak reference to |object| (which is left untouched).
+  explicit WeakObject(jobject object)
+      : object_ref_(object ? LifecycleT::NewReference(object) : nullptr) {}
+
+  // Creates a new weak reference to the referent of a local or global object.
+  template <typename T, typename = std::enable_if_t<
+                            std::is_base_of_v<RefBaseTag<jobject>, T>>>
+  explicit WeakObject(const T& object)
+      : WeakObject(static_cast<jobject>(object)) {}
+
+  WeakObject(const WeakObject&) = delete;
+  WeakObject& operator=(const WeakObject&) = delete;
+
+  WeakObject(WeakObject&& rhs) : object_ref_(rhs.Release()) {}
+
+  WeakObject& operator=(WeakObject&& rhs) {
+    if (this != &rhs) {
+      Reset();
+      object_ref_ = rhs.Release();
+    }
+
+    return *this;
+  }
+
+  ~WeakObject() { Reset(); }
+
+  // Returns a strong local reference to the referent, or std::nullopt if it
+  // has been collected (or this is empty).
+  //
+  // The referent is resolved with a single |NewLocalRef|, which returns null
+  // for collected objects, so there is no window between checking and
+  // locking where the referent could be collected.
+  std::optional<LocalT> Lock() const {
+    if (!object_ref_) {
+      return std::nullopt;
+    }
+
+    jobject local = JniEnv::GetEnv()->NewLocalRef(object_ref_);
+    if (!local) {
+      return std::nullopt;
+    }
+
+    return std::optional<LocalT>{std::in_place, local};
+  }
+
+  // True if the referent has been collected (or this is empty).  Cheaper than
+  // |Lock| as no reference is created, but the referent may be collected
+  // immediately after this returns false.
+  bool IsCleared() const {
+    return !object_ref_ || LifecycleT::IsCleared(object_ref_);
+  }
+
+  // Deletes the weak reference (the referent is unaffected).
+  void Reset() {
+    if (object_ref_) {
+      LifecycleT::Delete(object_ref_);
+      object_ref_ = nullptr;
+    }
+  }
+
+  // Releases ownership of the underlying weak reference.
+  jweak Release() { return std::exchange(object_ref_, nullptr); }
+
+ private:
+  jweak object_ref_ = nullptr;
+};
+
+template <const auto& class_v_, const auto& class_loader_v_, const auto& jvm_v_>
+WeakObject(const LocalObject<class_v_, class_loader_v_, jvm_v_>&)
+    -> WeakObject<class_v_, class_loader_v_, jvm_v_>;
+
+template <const auto& class_v_, const auto& class_loader_v_, const auto& jvm_v_>
+WeakObject(const GlobalObject<class_v_, class_loader_v_, jvm_v_>&)
+    -> WeakObject<class_v_, class_loader_v_, jvm_v_>;
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_WEAK_OBJECT_H_
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <optional>
+#include <utility>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Class;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::WeakObject;
+using ::jni::test::Fake;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::Return;
+
+static constexpr Class kClass{"kClass",
+                              Method{"Foo", jni::Return{}, Params{}}};
+
+TEST_F(JniTest, WeakObject_CreatesAndDeletesWeakGlobalRef) {
+  EXPECT_CALL(*env_, NewWeakGlobalRef(Fake<jobject>(1)))
+      .WillOnce(Return(Fake<jweak>(2)));
+  EXPECT_CALL(*env_, DeleteWeakGlobalRef(Fake<jweak>(2)));
+  EXPECT_CALL(*env_, NewGlobalRef).Times(0);
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(1)));
+
+  LocalObject<kClass> obj{Fake<jobject>(1)};
+  WeakObject weak{obj};
+}
+
+TEST_F(JniTest, WeakObject_NullIsEmptyAndCleared) {
+  EXPECT_CALL(*env_, NewWeakGlobalRef).Times(0);
+  EXPECT_CALL(*env_, DeleteWeakGlobalRef).Times(0);
+  EXPECT_CALL(*env_, NewLocalRef).Times(0);
+
+  WeakObject<kClass> weak{nullptr};
+  EXPECT_TRUE(weak.IsCleared());
+  EXPECT_FALSE(weak.Lock().has_value());
+}
+
+TEST_F(JniTest, WeakObject_DetectsClearedReferenceWithIsSameObject) {
+  EXPECT_CALL(*env_, NewWeakGlobalRef).WillOnce(Return(Fake<jweak>()));
+  EXPECT_CALL(*env_, IsSameObject(Fake<jweak>(), nullptr))
+      .WillOnce(Return(JNI_FALSE))
+      .WillOnce(Return(JNI_TRUE));
+
+  WeakObject<kClass> weak{Fake<jobject>()};
+  EXPECT_FALSE(weak.IsCleared());
+  EXPECT_TRUE(weak.IsCleared());
+}
+
+TEST_F(JniTest, WeakObject_LockReturnsLocalObjectWhileAlive) {
+  EXPECT_CALL(*env_, NewWeakGlobalRef).WillOnce(Return(Fake<jweak>()));
+  EXPECT_CALL(*env_, NewLocalRef(Fake<jweak>()))
+      .WillOnce(Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, CallVoidMethodV(Fake<jobject>(2), _, _));
+  EXPECT_CALL(*env_, DeleteLocalRef(_)).Times(AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(2)));
+
+  WeakObject<kClass> weak{Fake<jobject>(1)};
+  std::optional<LocalObject<kClass>> obj = weak.Lock();
+  ASSERT_TRUE(obj.has_value());
+  (*obj)("Foo");
+}
+
+TEST_F(JniTest, WeakObject_LockReturnsNulloptOnceCollected) {
+  EXPECT_CALL(*env_, NewWeakGlobalRef).WillOnce(Return(Fake<jweak>()));
+  EXPECT_CALL(*env_, NewLocalRef(Fake<jweak>())).WillOnce(Return(nullptr));
+  EXPECT_CALL(*env_, DeleteWeakGlobalRef(Fake<jweak>()));
+
+  WeakObject<kClass> weak{Fake<jobject>()};
+  EXPECT_FALSE(weak.Lock().has_value());
+}
+
+TEST_F(JniTest, WeakObject_MovesOwnership) {
+  EXPECT_CALL(*env_, NewWeakGlobalRef(Fake<jobject>(1)))
+      .WillOnce(Return(Fake<jweak>(3)));
+  EXPECT_CALL(*env_, NewWeakGlobalRef(Fake<jobject>(2)))
+      .WillOnce(Return(Fake<jweak>(4)));
+  EXPECT_CALL(*env_, DeleteWeakGlobalRef(Fake<jweak>(3)));
+  EXPECT_CALL(*env_, DeleteWeakGlobalRef(Fake<jweak>(4)));
+
+  WeakObject<kClass> weak_1{Fake<jobject>(1)};
+  WeakObject<kClass> weak_2{Fake<jobject>(2)};
+  WeakObject<kClass> moved{std::move(weak_1)};
+
+  // |weak_1|'s reference is deleted on assignment.
+  moved = std::move(weak_2);
+  EXPECT_EQ(moved.Release(), Fake<jweak>(4));
+  jni::LifecycleHelper<jobject, jni::LifecycleType::WEAK>::Delete(
+      Fake<jweak>(4));
+}
+
+}  // namespace
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.jnibind.test;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import org.junit.AfterClass;
+import org.junit.Test;
+import org.junit.runner.RunWith;
+import org.junit.runners.JUnit4;
+
+/**
+ * Times native iteration over large ObjectTestHelper[] arrays, summing intVal1 of every element.
+ * Compares ArrayView's raw iterator (whose locals are left to an enclosing LocalFrame), the same
+ * iterator with each element deleted as it is used, and jni::ArrayRef::Elements(). Also times
+ * summing int[] arrays of 1KB to 256MB pinned with Pin() (Get<Type>ArrayElements) against
+ * PinCritical() (GetPrimitiveArrayCritical). Timings are printed, not asserted.
+ */
+@RunWith(JUnit4.class)
+public final class ArrayIterationBenchmark {
+  static {
+    System.loadLibrary("array_iteration_benchmark_jni");
+  }
+
+  // Indexes the native iteration modes, keep in sync with array_iteration_benchmark_jni.cc.
+  private static final String[] MODES = {"pin (leaked)", "pin (scoped)", "elements"};
+
+  private static final int[] SIZES = {100_000, 1_000_000};
+  private static final int WARMUP_ITERATIONS = 3;
+  private static final int ITERATIONS = 10;
+
+  // 1KB to 256MB, each pinned until about 1GB has been summed.
+  private static final int[] PIN_SIZES_BYTES = {
+    1 << 10, 1 << 14, 1 << 18, 1 << 22, 1 << 26, 1 << 28
+  };
+  private static final long PIN_BYTES_PER_SIZE = 1L << 30;
+  private static final int MAX_PIN_ITERATIONS = 100_000;
+
+  static native void jniTearDown();
+
+  /** Returns the sum of intVal1 over |arr|. */
+  static native long jniSumElements(ObjectTestHelper[] arr, int mode);
+
+  /** Returns the sum of |arr|, pinned critically if |critical|. */
+  static native long jniSumInts(int[] arr, boolean critical);
+
+  @AfterClass
+  public static void doShutDown() {
+    jniTearDown();
+  }
+
+  @Test
+  public void iterateLargeObjectArrays() {
+    for (int size : SIZES) {
+      ObjectTestHelper[] arr = new ObjectTestHelper[size];
+      long expectedSum = 0;
+      for (int i = 0; i < size; ++i) {
+        arr[i] = new ObjectTestHelper(i % 7);
+        expectedSum += i % 7;
+      }
+
+      for (int mode = 0; mode < MODES.length; ++mode) {
+        for (int i = 0; i < WARMUP_ITERATIONS; ++i) {
+          assertThat(jniSumElements(arr, mode)).isEqualTo(expectedSum);
+        }
+
+        long start = System.nanoTime();
+        for (int i = 0; i < ITERATIONS; ++i) {
+          assertThat(jniSumElements(arr, mode)).isEqualTo(expectedSum);
+        }
+        long nanos = System.nanoTime() - start;
+
+        System.out.printf(
+            "%7d x %-12s: %6.1f ns/element%n",
+            size, MODES[mode], (double) nanos / ITERATIONS / size);
+      }
+    }
+  }
+
+  @Test
+  public void pinVersusPinCritical() {
+    for (int sizeBytes : PIN_SIZES_BYTES) {
+      int[] arr = new int[sizeBytes / Integer.BYTES];
+      long expectedSum = 0;
+      for (int i = 0; i < arr.length; ++i) {
+        arr[i] = i % 7;
+        expectedSum += i % 7;
+      }
+
+      int iterations = (int) Math.min(MAX_PIN_ITERATIONS, PIN_BYTES_PER_SIZE / sizeBytes);
+      for (int i = 0; i < WARMUP_ITERATIONS; ++i) {
+        assertThat(jniSumInts(arr, false)).isEqualTo(expectedSum);
+        assertThat(jniSumInts(arr, true)).isEqualTo(expectedSum);
+      }
+
+      long start = System.nanoTime();
+      for (int i = 0; i < iterations; ++i) {
+        assertThat(jniSumInts(arr, false)).isEqualTo(expectedSum);
+      }
+      long pinNanos = System.nanoTime() - start;
+
+      start = System.nanoTime();
+      for (int i = 0; i < iterations; ++i) {
+        assertThat(jniSumInts(arr, true)).isEqualTo(expectedSum);
+      }
+      long criticalNanos = System.nanoTime() - start;
+
+      System.out.printf(
+          "%9d bytes: pin %10.1f us, pin critical %10.1f us%n",
+          sizeBytes, pinNanos / 1e3 / iterations, criticalNanos / 1e3 / iterations);
+    }
+  }
+}
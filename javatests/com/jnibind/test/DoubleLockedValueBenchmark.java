@@ -0,0 +1,91 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.jnibind.test;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import org.junit.AfterClass;
+import org.junit.Test;
+import org.junit.runner.RunWith;
+import org.junit.runners.JUnit4;
+
+/**
+ * Times jni::metaprogramming::DoubleLockedValue (which caches every jclass, jmethodID and
+ * jfieldID) against a std::mutex guarded equivalent: loads of an initialised value, and many
+ * threads racing to initialise the same values as they do at startup. Timings are printed, not
+ * asserted.
+ */
+@RunWith(JUnit4.class)
+public final class DoubleLockedValueBenchmark {
+  static {
+    System.loadLibrary("double_locked_value_benchmark_jni");
+  }
+
+  private static final int[] NUM_THREADS = {1, 4, 16};
+  private static final int NUM_VALUES = 10_000;
+  private static final int WARMUP_ITERATIONS = 100_000;
+  private static final int ITERATIONS = 10_000_000;
+
+  static native void jniTearDown();
+
+  /** Returns the nanoseconds taken by |iterations| loads of an initialised value. */
+  static native long jniTimeHitPath(int iterations, boolean mutex);
+
+  /**
+   * Returns the nanoseconds taken by |numThreads| threads each loading the same |numValues|
+   * uninitialised values, and the number of initialisations performed in |outInits[0]|.
+   */
+  static native long jniTimeContendedInit(
+      int numThreads, int numValues, boolean mutex, int[] outInits);
+
+  @AfterClass
+  public static void doShutDown() {
+    jniTearDown();
+  }
+
+  @Test
+  public void hitPath() {
+    jniTimeHitPath(WARMUP_ITERATIONS, false);
+    jniTimeHitPath(WARMUP_ITERATIONS, true);
+
+    long flagNanos = jniTimeHitPath(ITERATIONS, false);
+    long mutexNanos = jniTimeHitPath(ITERATIONS, true);
+
+    System.out.printf(
+        "hit path: flag %5.2f ns/load, mutex %5.2f ns/load%n",
+        (double) flagNanos / ITERATIONS, (double) mutexNanos / ITERATIONS);
+  }
+
+  @Test
+  public void contendedInit() {
+    int[] inits = new int[1];
+
+    for (int numThreads : NUM_THREADS) {
+      jniTimeContendedInit(numThreads, NUM_VALUES, false, inits);
+      jniTimeContendedInit(numThreads, NUM_VALUES, true, inits);
+
+      long flagNanos = jniTimeContendedInit(numThreads, NUM_VALUES, false, inits);
+      assertThat(inits[0]).isEqualTo(NUM_VALUES);
+      long mutexNanos = jniTimeContendedInit(numThreads, NUM_VALUES, true, inits);
+      assertThat(inits[0]).isEqualTo(NUM_VALUES);
+
+      System.out.printf(
+          "%2d threads: flag %7.1f ns/value, mutex %7.1f ns/value%n",
+          numThreads, (double) flagNanos / NUM_VALUES, (double) mutexNanos / NUM_VALUES);
+    }
+  }
+}
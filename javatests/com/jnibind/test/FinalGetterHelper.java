@@ -0,0 +1,33 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.jnibind.test;
+
+/**
+ * A final class with a hot getter. InvocationBenchmark calls it both virtually and through
+ * CallNonvirtualIntMethod (see jni::Final).
+ */
+public final class FinalGetterHelper {
+  private final int value;
+
+  public FinalGetterHelper(int value) {
+    this.value = value;
+  }
+
+  public int getValue() {
+    return value;
+  }
+}
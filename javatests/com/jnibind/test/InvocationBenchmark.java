@@ -0,0 +1,109 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.jnibind.test;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import org.junit.AfterClass;
+import org.junit.Test;
+import org.junit.runner.RunWith;
+import org.junit.runners.JUnit4;
+
+/**
+ * Times native calls into InvocationBenchmarkHelper for methods taking 0 to 8 arguments of each
+ * primitive type, through the C varargs entry points (e.g. CallVoidMethodV) and through jvalue
+ * arrays (e.g. CallVoidMethodA, see jni::JValueArgs). It also times a getter of a final class
+ * called virtually and non-virtually (see jni::Final). Timings are printed, not asserted.
+ */
+@RunWith(JUnit4.class)
+public final class InvocationBenchmark {
+  static {
+    System.loadLibrary("invocation_benchmark_jni");
+  }
+
+  // Indexes the native dispatch table, keep in sync with invocation_benchmark_jni.cc.
+  private static final String[] TYPES = {
+    "boolean", "byte", "char", "short", "int", "long", "float", "double"
+  };
+  private static final int MAX_ARITY = 8;
+
+  private static final int WARMUP_ITERATIONS = 10_000;
+  private static final int ITERATIONS = 100_000;
+
+  static native void jniTearDown();
+
+  /** Returns the nanoseconds taken by |iterations| calls. */
+  static native long jniTimeInvocations(
+      InvocationBenchmarkHelper helper, int type, int arity, int iterations, boolean jvalueArgs);
+
+  /** Returns the sum of |iterations| calls to |helper.getValue()|. */
+  static native long jniSumGetter(FinalGetterHelper helper, int iterations, boolean nonvirtual);
+
+  @AfterClass
+  public static void doShutDown() {
+    jniTearDown();
+  }
+
+  @Test
+  public void varargsVersusJValueArgs() {
+    InvocationBenchmarkHelper helper = new InvocationBenchmarkHelper();
+    long expectedCalls = 0;
+
+    for (int type = 0; type < TYPES.length; ++type) {
+      for (int arity = 0; arity <= MAX_ARITY; ++arity) {
+        jniTimeInvocations(helper, type, arity, WARMUP_ITERATIONS, false);
+        jniTimeInvocations(helper, type, arity, WARMUP_ITERATIONS, true);
+
+        long varargsNanos = jniTimeInvocations(helper, type, arity, ITERATIONS, false);
+        long jvalueNanos = jniTimeInvocations(helper, type, arity, ITERATIONS, true);
+        expectedCalls += 2 * (WARMUP_ITERATIONS + ITERATIONS);
+
+        System.out.printf(
+            "%-7s x %d: varargs %6.1f ns/call, jvalue %6.1f ns/call%n",
+            TYPES[type],
+            arity,
+            (double) varargsNanos / ITERATIONS,
+            (double) jvalueNanos / ITERATIONS);
+      }
+    }
+
+    assertThat(helper.calls).isEqualTo(expectedCalls);
+  }
+
+  @Test
+  public void virtualVersusNonvirtualGetter() {
+    FinalGetterHelper helper = new FinalGetterHelper(3);
+
+    jniSumGetter(helper, WARMUP_ITERATIONS, false);
+    jniSumGetter(helper, WARMUP_ITERATIONS, true);
+
+    long start = System.nanoTime();
+    long virtualSum = jniSumGetter(helper, ITERATIONS, false);
+    long virtualNanos = System.nanoTime() - start;
+
+    start = System.nanoTime();
+    long nonvirtualSum = jniSumGetter(helper, ITERATIONS, true);
+    long nonvirtualNanos = System.nanoTime() - start;
+
+    System.out.printf(
+        "getValue: virtual %6.1f ns/call, nonvirtual %6.1f ns/call%n",
+        (double) virtualNanos / ITERATIONS, (double) nonvirtualNanos / ITERATIONS);
+
+    assertThat(virtualSum).isEqualTo(3L * ITERATIONS);
+    assertThat(nonvirtualSum).isEqualTo(3L * ITERATIONS);
+  }
+}
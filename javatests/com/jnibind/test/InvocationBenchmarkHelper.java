@@ -0,0 +1,327 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.jnibind.test;
+
+/**
+ * Trivial targets for InvocationBenchmark. Every primitive type has an overload taking 0 to 8
+ * arguments, and a call only counts itself so the benchmark measures the cost of getting there.
+ */
+public class InvocationBenchmarkHelper {
+  public long calls = 0;
+
+  /** Boolean arguments. */
+  public void booleans() {
+    calls++;
+  }
+
+  public void booleans(boolean a0) {
+    calls++;
+  }
+
+  public void booleans(boolean a0, boolean a1) {
+    calls++;
+  }
+
+  public void booleans(boolean a0, boolean a1, boolean a2) {
+    calls++;
+  }
+
+  public void booleans(boolean a0, boolean a1, boolean a2, boolean a3) {
+    calls++;
+  }
+
+  public void booleans(boolean a0, boolean a1, boolean a2, boolean a3, boolean a4) {
+    calls++;
+  }
+
+  public void booleans(boolean a0, boolean a1, boolean a2, boolean a3, boolean a4, boolean a5) {
+    calls++;
+  }
+
+  public void booleans(
+      boolean a0, boolean a1, boolean a2, boolean a3, boolean a4, boolean a5, boolean a6) {
+    calls++;
+  }
+
+  public void booleans(
+      boolean a0, boolean a1, boolean a2, boolean a3, boolean a4, boolean a5, boolean a6,
+      boolean a7) {
+    calls++;
+  }
+
+  /** Byte arguments. */
+  public void bytes() {
+    calls++;
+  }
+
+  public void bytes(byte a0) {
+    calls++;
+  }
+
+  public void bytes(byte a0, byte a1) {
+    calls++;
+  }
+
+  public void bytes(byte a0, byte a1, byte a2) {
+    calls++;
+  }
+
+  public void bytes(byte a0, byte a1, byte a2, byte a3) {
+    calls++;
+  }
+
+  public void bytes(byte a0, byte a1, byte a2, byte a3, byte a4) {
+    calls++;
+  }
+
+  public void bytes(byte a0, byte a1, byte a2, byte a3, byte a4, byte a5) {
+    calls++;
+  }
+
+  public void bytes(byte a0, byte a1, byte a2, byte a3, byte a4, byte a5, byte a6) {
+    calls++;
+  }
+
+  public void bytes(byte a0, byte a1, byte a2, byte a3, byte a4, byte a5, byte a6, byte a7) {
+    calls++;
+  }
+
+  /** Char arguments. */
+  public void chars() {
+    calls++;
+  }
+
+  public void chars(char a0) {
+    calls++;
+  }
+
+  public void chars(char a0, char a1) {
+    calls++;
+  }
+
+  public void chars(char a0, char a1, char a2) {
+    calls++;
+  }
+
+  public void chars(char a0, char a1, char a2, char a3) {
+    calls++;
+  }
+
+  public void chars(char a0, char a1, char a2, char a3, char a4) {
+    calls++;
+  }
+
+  public void chars(char a0, char a1, char a2, char a3, char a4, char a5) {
+    calls++;
+  }
+
+  public void chars(char a0, char a1, char a2, char a3, char a4, char a5, char a6) {
+    calls++;
+  }
+
+  public void chars(char a0, char a1, char a2, char a3, char a4, char a5, char a6, char a7) {
+    calls++;
+  }
+
+  /** Short arguments. */
+  public void shorts() {
+    calls++;
+  }
+
+  public void shorts(short a0) {
+    calls++;
+  }
+
+  public void shorts(short a0, short a1) {
+    calls++;
+  }
+
+  public void shorts(short a0, short a1, short a2) {
+    calls++;
+  }
+
+  public void shorts(short a0, short a1, short a2, short a3) {
+    calls++;
+  }
+
+  public void shorts(short a0, short a1, short a2, short a3, short a4) {
+    calls++;
+  }
+
+  public void shorts(short a0, short a1, short a2, short a3, short a4, short a5) {
+    calls++;
+  }
+
+  public void shorts(short a0, short a1, short a2, short a3, short a4, short a5, short a6) {
+    calls++;
+  }
+
+  public void shorts(
+      short a0, short a1, short a2, short a3, short a4, short a5, short a6, short a7) {
+    calls++;
+  }
+
+  /** Int arguments. */
+  public void ints() {
+    calls++;
+  }
+
+  public void ints(int a0) {
+    calls++;
+  }
+
+  public void ints(int a0, int a1) {
+    calls++;
+  }
+
+  public void ints(int a0, int a1, int a2) {
+    calls++;
+  }
+
+  public void ints(int a0, int a1, int a2, int a3) {
+    calls++;
+  }
+
+  public void ints(int a0, int a1, int a2, int a3, int a4) {
+    calls++;
+  }
+
+  public void ints(int a0, int a1, int a2, int a3, int a4, int a5) {
+    calls++;
+  }
+
+  public void ints(int a0, int a1, int a2, int a3, int a4, int a5, int a6) {
+    calls++;
+  }
+
+  public void ints(int a0, int a1, int a2, int a3, int a4, int a5, int a6, int a7) {
+    calls++;
+  }
+
+  /** Long arguments. */
+  public void longs() {
+    calls++;
+  }
+
+  public void longs(long a0) {
+    calls++;
+  }
+
+  public void longs(long a0, long a1) {
+    calls++;
+  }
+
+  public void longs(long a0, long a1, long a2) {
+    calls++;
+  }
+
+  public void longs(long a0, long a1, long a2, long a3) {
+    calls++;
+  }
+
+  public void longs(long a0, long a1, long a2, long a3, long a4) {
+    calls++;
+  }
+
+  public void longs(long a0, long a1, long a2, long a3, long a4, long a5) {
+    calls++;
+  }
+
+  public void longs(long a0, long a1, long a2, long a3, long a4, long a5, long a6) {
+    calls++;
+  }
+
+  public void longs(long a0, long a1, long a2, long a3, long a4, long a5, long a6, long a7) {
+    calls++;
+  }
+
+  /** Float arguments. */
+  public void floats() {
+    calls++;
+  }
+
+  public void floats(float a0) {
+    calls++;
+  }
+
+  public void floats(float a0, float a1) {
+    calls++;
+  }
+
+  public void floats(float a0, float a1, float a2) {
+    calls++;
+  }
+
+  public void floats(float a0, float a1, float a2, float a3) {
+    calls++;
+  }
+
+  public void floats(float a0, float a1, float a2, float a3, float a4) {
+    calls++;
+  }
+
+  public void floats(float a0, float a1, float a2, float a3, float a4, float a5) {
+    calls++;
+  }
+
+  public void floats(float a0, float a1, float a2, float a3, float a4, float a5, float a6) {
+    calls++;
+  }
+
+  public void floats(
+      float a0, float a1, float a2, float a3, float a4, float a5, float a6, float a7) {
+    calls++;
+  }
+
+  /** Double arguments. */
+  public void doubles() {
+    calls++;
+  }
+
+  public void doubles(double a0) {
+    calls++;
+  }
+
+  public void doubles(double a0, double a1) {
+    calls++;
+  }
+
+  public void doubles(double a0, double a1, double a2) {
+    calls++;
+  }
+
+  public void doubles(double a0, double a1, double a2, double a3) {
+    calls++;
+  }
+
+  public void doubles(double a0, double a1, double a2, double a3, double a4) {
+    calls++;
+  }
+
+  public void doubles(double a0, double a1, double a2, double a3, double a4, double a5) {
+    calls++;
+  }
+
+  public void doubles(double a0, double a1, double a2, double a3, double a4, double a5, double a6) {
+    calls++;
+  }
+
+  public void doubles(
+      double a0, double a1, double a2, double a3, double a4, double a5, double a6, double a7) {
+    calls++;
+  }
+}
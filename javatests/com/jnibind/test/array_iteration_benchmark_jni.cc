@@ -0,0 +1,126 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+
+#include "object_test_helper_jni.h"
+#include "jni_bind.h"
+
+using ::jni::LocalArray;
+using ::jni::LocalFrame;
+using ::jni::LocalObject;
+using ::jni::PinMode;
+
+static std::unique_ptr<jni::JvmRef<jni::kDefaultJvm>> jvm;
+
+namespace {
+
+// Keep in sync with |MODES| in ArrayIterationBenchmark.java.
+enum Mode : jint {
+  kPinLeaked = 0,
+  kPinScoped = 1,
+  kElements = 2,
+};
+
+using ObjectArray = LocalArray<jobject, 1, kObjectTestHelperClass>;
+
+// Every dereference leaves a local behind which the frame frees when it pops,
+// growing the local reference table along the way.
+jlong SumPinLeaked(ObjectArray& arr) {
+  LocalFrame frame{};
+  jlong sum = 0;
+  for (jobject raw : arr.Pin()) {
+    LocalObject<kObjectTestHelperClass> obj{raw};
+    sum += obj["intVal1"].Get();
+    obj.Release();
+  }
+
+  return sum;
+}
+
+// Deletes each element as it is used.
+jlong SumPinScoped(ObjectArray& arr) {
+  jlong sum = 0;
+  for (jobject raw : arr.Pin()) {
+    sum += LocalObject<kObjectTestHelperClass>{raw}["intVal1"].Get();
+  }
+
+  return sum;
+}
+
+jlong SumElements(ObjectArray& arr) {
+  jlong sum = 0;
+  for (auto& obj : arr.Elements()) {
+    sum += obj["intVal1"].Get();
+  }
+
+  return sum;
+}
+
+// Read only, so neither pin copies back.
+jlong SumInts(LocalArray<jint>& arr, bool critical) {
+  jlong sum = 0;
+  if (critical) {
+    for (jint val : arr.PinCritical(PinMode::kReadOnly)) {
+      sum += val;
+    }
+  } else {
+    for (jint val : arr.Pin(PinMode::kReadOnly)) {
+      sum += val;
+    }
+  }
+
+  return sum;
+}
+
+}  // namespace
+
+extern "C" {
+
+JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* pjvm, void* reserved) {
+  jvm.reset(new jni::JvmRef<jni::kDefaultJvm>(pjvm));
+  return JNI_VERSION_1_6;
+}
+
+JNIEXPORT void JNICALL
+Java_com_jnibind_test_ArrayIterationBenchmark_jniTearDown(JNIEnv* env,
+                                                          jclass) {
+  jvm = nullptr;
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_jnibind_test_ArrayIterationBenchmark_jniSumElements(
+    JNIEnv* env, jclass, jobjectArray object_array, jint mode) {
+  ObjectArray arr{object_array};
+  switch (mode) {
+    case kPinLeaked:
+      return SumPinLeaked(arr);
+    case kPinScoped:
+      return SumPinScoped(arr);
+    default:
+      return SumElements(arr);
+  }
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_jnibind_test_ArrayIterationBenchmark_jniSumInts(JNIEnv* env, jclass,
+                                                        jintArray int_array,
+                                                        jboolean critical) {
+  LocalArray<jint> arr{int_array};
+  return SumInts(arr, critical);
+}
+
+}  // extern "C"
@@ -0,0 +1,161 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>  // NOLINT
+#include <memory>
+#include <mutex>  // NOLINT
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "jni_bind.h"
+#include "metaprogramming/double_locked_value.h"
+
+using ::jni::LocalArray;
+using ::jni::metaprogramming::DoubleLockedValue;
+
+static std::unique_ptr<jni::JvmRef<jni::kDefaultJvm>> jvm;
+
+namespace {
+
+// Baseline: the std::mutex guarded value DoubleLockedValue used to be.
+template <typename T>
+class MutexLockedValue {
+ public:
+  template <typename Lambda>
+  T LoadAndMaybeInit(Lambda lambda) {
+    T return_value = value_.load(std::memory_order_acquire);
+    if (return_value != T{0}) {
+      return return_value;
+    }
+
+    std::lock_guard<std::mutex> lock_guard{lock_};
+    return_value = value_.load(std::memory_order_acquire);
+    if (return_value == T{0}) {
+      return_value = lambda();
+      value_.store(return_value, std::memory_order_release);
+    }
+
+    return return_value;
+  }
+
+ private:
+  std::atomic<T> value_ = {0};
+  std::mutex lock_;
+};
+
+// Stands in for a GetMethodID style lookup.
+jint ExpensiveInit(std::atomic<jint>& num_inits) {
+  volatile int spin = 0;
+  for (int i = 0; i < 100; ++i) {
+    spin = spin + 1;
+  }
+
+  return ++num_inits;
+}
+
+template <typename Value>
+jlong TimeHitPath(jint iterations) {
+  std::atomic<jint> num_inits = 0;
+  Value value;
+  value.LoadAndMaybeInit([&] { return ExpensiveInit(num_inits); });
+
+  const auto start = std::chrono::steady_clock::now();
+  jlong sum = 0;
+  for (jint i = 0; i < iterations; ++i) {
+    sum += value.LoadAndMaybeInit([&] { return ExpensiveInit(num_inits); });
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  // Keeps |sum| (and so the loads) from being optimised away.
+  if (sum != iterations) {
+    return -1;
+  }
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+      .count();
+}
+
+// Every thread walks the same values, so each value's first touch is raced.
+template <typename Value>
+jlong TimeContendedInit(jint num_threads, jint num_values,
+                        jint& num_inits_out) {
+  std::atomic<jint> num_inits = 0;
+  std::atomic<bool> go = false;
+  std::vector<Value> values(num_values);
+
+  std::vector<std::thread> threads;
+  for (jint i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&] {
+      while (!go.load(std::memory_order_acquire)) {
+      }
+
+      for (Value& value : values) {
+        value.LoadAndMaybeInit([&] { return ExpensiveInit(num_inits); });
+      }
+    });
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  go.store(true, std::memory_order_release);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  num_inits_out = num_inits.load();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+      .count();
+}
+
+}  // namespace
+
+extern "C" {
+
+JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* pjvm, void* reserved) {
+  jvm.reset(new jni::JvmRef<jni::kDefaultJvm>(pjvm));
+  return JNI_VERSION_1_6;
+}
+
+JNIEXPORT void JNICALL
+Java_com_jnibind_test_DoubleLockedValueBenchmark_jniTearDown(JNIEnv* env,
+                                                             jclass) {
+  jvm = nullptr;
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_jnibind_test_DoubleLockedValueBenchmark_jniTimeHitPath(
+    JNIEnv* env, jclass, jint iterations, jboolean mutex) {
+  return mutex ? TimeHitPath<MutexLockedValue<jint>>(iterations)
+               : TimeHitPath<DoubleLockedValue<jint>>(iterations);
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_jnibind_test_DoubleLockedValueBenchmark_jniTimeContendedInit(
+    JNIEnv* env, jclass, jint num_threads, jint num_values, jboolean mutex,
+    jintArray out_inits) {
+  jint num_inits = 0;
+  const jlong nanos =
+      mutex ? TimeContendedInit<MutexLockedValue<jint>>(num_threads,
+                                                        num_values, num_inits)
+            : TimeContendedInit<DoubleLockedValue<jint>>(
+                  num_threads, num_values, num_inits);
+
+  LocalArray<jint>{out_inits}.SetRegion(0, 1, &num_inits);
+  return nanos;
+}
+
+}  // extern "C"
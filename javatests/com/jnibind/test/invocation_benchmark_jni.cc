@@ -0,0 +1,240 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <chrono>  // NOLINT
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "jni_bind.h"
+
+using ::jni::Class;
+using ::jni::Final;
+using ::jni::JValueArgs;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Overload;
+using ::jni::Params;
+using ::jni::Return;
+
+static std::unique_ptr<jni::JvmRef<jni::kDefaultJvm>> jvm;
+
+// clang-format off
+static constexpr Class kVarargsHelper{
+    "com/jnibind/test/InvocationBenchmarkHelper",
+    Method{"booleans",
+      Overload{Return{}, Params<>{}},
+      Overload{Return{}, Params<jboolean>{}},
+      Overload{Return{}, Params<jboolean,jboolean>{}},
+      Overload{Return{}, Params<jboolean,jboolean,jboolean>{}},
+      Overload{Return{}, Params<jboolean,jboolean,jboolean,jboolean>{}},
+      Overload{Return{}, Params<jboolean,jboolean,jboolean,jboolean,jboolean>{}},
+      Overload{Return{}, Params<jboolean,jboolean,jboolean,jboolean,jboolean,jboolean>{}},
+      Overload{Return{}, Params<jboolean,jboolean,jboolean,jboolean,jboolean,jboolean,jboolean>{}},
+      Overload{Return{}, Params<jboolean,jboolean,jboolean,jboolean,jboolean,jboolean,jboolean,jboolean>{}}},
+    Method{"bytes",
+      Overload{Return{}, Params<>{}},
+      Overload{Return{}, Params<jbyte>{}},
+      Overload{Return{}, Params<jbyte,jbyte>{}},
+      Overload{Return{}, Params<jbyte,jbyte,jbyte>{}},
+      Overload{Return{}, Params<jbyte,jbyte,jbyte,jbyte>{}},
+      Overload{Return{}, Params<jbyte,jbyte,jbyte,jbyte,jbyte>{}},
+      Overload{Return{}, Params<jbyte,jbyte,jbyte,jbyte,jbyte,jbyte>{}},
+      Overload{Return{}, Params<jbyte,jbyte,jbyte,jbyte,jbyte,jbyte,jbyte>{}},
+      Overload{Return{}, Params<jbyte,jbyte,jbyte,jbyte,jbyte,jbyte,jbyte,jbyte>{}}},
+    Method{"chars",
+      Overload{Return{}, Params<>{}},
+      Overload{Return{}, Params<jchar>{}},
+      Overload{Return{}, Params<jchar,jchar>{}},
+      Overload{Return{}, Params<jchar,jchar,jchar>{}},
+      Overload{Return{}, Params<jchar,jchar,jchar,jchar>{}},
+      Overload{Return{}, Params<jchar,jchar,jchar,jchar,jchar>{}},
+      Overload{Return{}, Params<jchar,jchar,jchar,jchar,jchar,jchar>{}},
+      Overload{Return{}, Params<jchar,jchar,jchar,jchar,jchar,jchar,jchar>{}},
+      Overload{Return{}, Params<jchar,jchar,jchar,jchar,jchar,jchar,jchar,jchar>{}}},
+    Method{"shorts",
+      Overload{Return{}, Params<>{}},
+      Overload{Return{}, Params<jshort>{}},
+      Overload{Return{}, Params<jshort,jshort>{}},
+      Overload{Return{}, Params<jshort,jshort,jshort>{}},
+      Overload{Return{}, Params<jshort,jshort,jshort,jshort>{}},
+      Overload{Return{}, Params<jshort,jshort,jshort,jshort,jshort>{}},
+      Overload{Return{}, Params<jshort,jshort,jshort,jshort,jshort,jshort>{}},
+      Overload{Return{}, Params<jshort,jshort,jshort,jshort,jshort,jshort,jshort>{}},
+      Overload{Return{}, Params<jshort,jshort,jshort,jshort,jshort,jshort,jshort,jshort>{}}},
+    Method{"ints",
+      Overload{Return{}, Params<>{}},
+      Overload{Return{}, Params<jint>{}},
+      Overload{Return{}, Params<jint,jint>{}},
+      Overload{Return{}, Params<jint,jint,jint>{}},
+      Overload{Return{}, Params<jint,jint,jint,jint>{}},
+      Overload{Return{}, Params<jint,jint,jint,jint,jint>{}},
+      Overload{Return{}, Params<jint,jint,jint,jint,jint,jint>{}},
+      Overload{Return{}, Params<jint,jint,jint,jint,jint,jint,jint>{}},
+      Overload{Return{}, Params<jint,jint,jint,jint,jint,jint,jint,jint>{}}},
+    Method{"longs",
+      Overload{Return{}, Params<>{}},
+      Overload{Return{}, Params<jlong>{}},
+      Overload{Return{}, Params<jlong,jlong>{}},
+      Overload{Return{}, Params<jlong,jlong,jlong>{}},
+      Overload{Return{}, Params<jlong,jlong,jlong,jlong>{}},
+      Overload{Return{}, Params<jlong,jlong,jlong,jlong,jlong>{}},
+      Overload{Return{}, Params<jlong,jlong,jlong,jlong,jlong,jlong>{}},
+      Overload{Return{}, Params<jlong,jlong,jlong,jlong,jlong,jlong,jlong>{}},
+      Overload{Return{}, Params<jlong,jlong,jlong,jlong,jlong,jlong,jlong,jlong>{}}},
+    Method{"floats",
+      Overload{Return{}, Params<>{}},
+      Overload{Return{}, Params<jfloat>{}},
+      Overload{Return{}, Params<jfloat,jfloat>{}},
+      Overload{Return{}, Params<jfloat,jfloat,jfloat>{}},
+      Overload{Return{}, Params<jfloat,jfloat,jfloat,jfloat>{}},
+      Overload{Return{}, Params<jfloat,jfloat,jfloat,jfloat,jfloat>{}},
+      Overload{Return{}, Params<jfloat,jfloat,jfloat,jfloat,jfloat,jfloat>{}},
+      Overload{Return{}, Params<jfloat,jfloat,jfloat,jfloat,jfloat,jfloat,jfloat>{}},
+      Overload{Return{}, Params<jfloat,jfloat,jfloat,jfloat,jfloat,jfloat,jfloat,jfloat>{}}},
+    Method{"doubles",
+      Overload{Return{}, Params<>{}},
+      Overload{Return{}, Params<jdouble>{}},
+      Overload{Return{}, Params<jdouble,jdouble>{}},
+      Overload{Return{}, Params<jdouble,jdouble,jdouble>{}},
+      Overload{Return{}, Params<jdouble,jdouble,jdouble,jdouble>{}},
+      Overload{Return{}, Params<jdouble,jdouble,jdouble,jdouble,jdouble>{}},
+      Overload{Return{}, Params<jdouble,jdouble,jdouble,jdouble,jdouble,jdouble>{}},
+      Overload{Return{}, Params<jdouble,jdouble,jdouble,jdouble,jdouble,jdouble,jdouble>{}},
+      Overload{Return{}, Params<jdouble,jdouble,jdouble,jdouble,jdouble,jdouble,jdouble,jdouble>{}}},
+};
+// clang-format on
+
+// The same class, invoked with jvalue arrays.
+static constexpr decltype(kVarargsHelper) kJValueHelper{JValueArgs{},
+                                                        kVarargsHelper};
+
+static constexpr Class kVirtualGetterHelper{
+    "com/jnibind/test/FinalGetterHelper",
+    Method{"getValue", Return<jint>{}, Params{}},
+};
+
+// The same class, invoked with CallNonvirtualIntMethod.
+static constexpr decltype(kVirtualGetterHelper) kFinalGetterHelper{
+    Final{}, kVirtualGetterHelper};
+
+namespace {
+
+// Calls the overload of |T| taking |sizeof...(Is)| arguments.
+template <typename T, typename HelperT, std::size_t... Is>
+void Invoke(HelperT& helper, std::index_sequence<Is...>) {
+  if constexpr (std::is_same_v<T, jboolean>) {
+    helper("booleans", static_cast<T>(Is % 2)...);
+  } else if constexpr (std::is_same_v<T, jbyte>) {
+    helper("bytes", static_cast<T>(Is)...);
+  } else if constexpr (std::is_same_v<T, jchar>) {
+    helper("chars", static_cast<T>(Is)...);
+  } else if constexpr (std::is_same_v<T, jshort>) {
+    helper("shorts", static_cast<T>(Is)...);
+  } else if constexpr (std::is_same_v<T, jint>) {
+    helper("ints", static_cast<T>(Is)...);
+  } else if constexpr (std::is_same_v<T, jlong>) {
+    helper("longs", static_cast<T>(Is)...);
+  } else if constexpr (std::is_same_v<T, jfloat>) {
+    helper("floats", static_cast<T>(Is)...);
+  } else {
+    helper("doubles", static_cast<T>(Is)...);
+  }
+}
+
+template <const auto& class_v, typename T, std::size_t kArity>
+jlong TimeInvocations(jobject object, jint iterations) {
+  LocalObject<class_v> helper{object};
+
+  auto start = std::chrono::steady_clock::now();
+  for (jint i = 0; i < iterations; ++i) {
+    Invoke<T>(helper, std::make_index_sequence<kArity>{});
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+      .count();
+}
+
+using TimerFn = jlong (*)(jobject, jint);
+static constexpr std::size_t kMaxArity = 8;
+
+template <const auto& class_v, typename T, std::size_t... kArities>
+constexpr std::array<TimerFn, kMaxArity + 1> MakeTimers(
+    std::index_sequence<kArities...>) {
+  return {&TimeInvocations<class_v, T, kArities>...};
+}
+
+// Indexed by [type][arity], type order matches InvocationBenchmark.java.
+template <const auto& class_v>
+constexpr std::array<std::array<TimerFn, kMaxArity + 1>, 8> MakeTimerTable() {
+  constexpr auto kArities = std::make_index_sequence<kMaxArity + 1>{};
+  return {MakeTimers<class_v, jboolean>(kArities),
+          MakeTimers<class_v, jbyte>(kArities),
+          MakeTimers<class_v, jchar>(kArities),
+          MakeTimers<class_v, jshort>(kArities),
+          MakeTimers<class_v, jint>(kArities),
+          MakeTimers<class_v, jlong>(kArities),
+          MakeTimers<class_v, jfloat>(kArities),
+          MakeTimers<class_v, jdouble>(kArities)};
+}
+
+static constexpr auto kVarargsTimers = MakeTimerTable<kVarargsHelper>();
+static constexpr auto kJValueTimers = MakeTimerTable<kJValueHelper>();
+
+template <const auto& class_v>
+jlong SumGetter(jobject object, jint iterations) {
+  LocalObject<class_v> helper{object};
+
+  jlong sum = 0;
+  for (jint i = 0; i < iterations; ++i) {
+    sum += helper("getValue");
+  }
+
+  return sum;
+}
+
+}  // namespace
+
+extern "C" {
+
+JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* pjvm, void* reserved) {
+  jvm.reset(new jni::JvmRef<jni::kDefaultJvm>(pjvm));
+  return JNI_VERSION_1_6;
+}
+
+JNIEXPORT void JNICALL
+Java_com_jnibind_test_InvocationBenchmark_jniTearDown(JNIEnv* env, jclass) {
+  jvm = nullptr;
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_jnibind_test_InvocationBenchmark_jniTimeInvocations(
+    JNIEnv* env, jclass, jobject helper, jint type, jint arity,
+    jint iterations, jboolean jvalue_args) {
+  const auto& timers = jvalue_args ? kJValueTimers : kVarargsTimers;
+  return timers[type][arity](helper, iterations);
+}
+
+JNIEXPORT jlong JNICALL Java_com_jnibind_test_InvocationBenchmark_jniSumGetter(
+    JNIEnv* env, jclass, jobject helper, jint iterations, jboolean nonvirtual) {
+  return nonvirtual ? SumGetter<kFinalGetterHelper>(helper, iterations)
+                    : SumGetter<kVirtualGetterHelper>(helper, iterations);
+}
+
+}  // extern "C"
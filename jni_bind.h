@@ -32,9 +32,12 @@
 #include "implementation/class_loader.h"
 #include "implementation/constructor.h"
 #include "implementation/field.h"
+#include "implementation/final.h"
 #include "implementation/id.h"
 #include "implementation/jni_type.h"
+#include "implementation/jvalue_args.h"
 #include "implementation/jvm.h"
+#include "implementation/literal.h"
 #include "implementation/loaded_by.h"
 #include "implementation/method.h"
 #include "implementation/no_idx.h"
@@ -48,20 +51,29 @@
 
 // Convenience headers for system libraries.
 #include "class_defs/java_lang_classes.h"
+#include "class_defs/java_nio_classes.h"
 #include "class_defs/java_util_classes.h"
 
 // Headers for dynamic definitions.
 #include "implementation/array_view.h"
+#include "implementation/direct_buffer.h"
+#include "implementation/flattened_array.h"
 #include "implementation/global_class_loader.h"
 #include "implementation/global_object.h"
 #include "implementation/global_string.h"
+#include "implementation/handoff_object.h"
 #include "implementation/jvm_ref.h"
 #include "implementation/local_array.h"
 #include "implementation/local_array_string.h"
 #include "implementation/local_class_loader.h"
+#include "implementation/local_frame.h"
 #include "implementation/local_object.h"
 #include "implementation/local_string.h"
 #include "implementation/promotion_mechanics.h"
+#include "implementation/scoped_elements.h"
+#include "implementation/shared_global_object.h"
+#include "implementation/tracked_array_view.h"
+#include "implementation/weak_object.h"
 
 // IWYU pragma: end_exports
 
@@ -17,6 +17,8 @@
 #ifndef JNI_BIND_JNI_TEST_H_
 #define JNI_BIND_JNI_TEST_H_
 
+#include <cstdint>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "implementation/fake_test_constants.h"
@@ -50,6 +52,31 @@ inline jobject AsGlobal(jobject object) {
   }
 }
 
+static constexpr std::size_t kWeakOffset = 0xCACA0000000000;
+
+// "Translates" a fake object into its weak global counterpart (see |AsGlobal|).
+inline jobject AsWeak(jobject object) {
+  if (object == nullptr) {
+    return nullptr;
+  }
+
+  return reinterpret_cast<jobject>(
+      reinterpret_cast<std::uintptr_t>(object) + kWeakOffset);
+}
+
+// Strips any |AsGlobal| or |AsWeak| translation, so references to the same fake
+// object compare equal.
+inline std::uintptr_t FakeReferent(jobject object) {
+  auto val = reinterpret_cast<std::uintptr_t>(object);
+  if (val >= kWeakOffset) {
+    return val - kWeakOffset;
+  } else if (val >= kGlobalOffset) {
+    return val - kGlobalOffset;
+  }
+
+  return val;
+}
+
 // JniTest that provides some simple fake behaviour when using mock JNIEnv and
 // mock JVM objects.  To skip setting up JvmRef (typical usage), use JniTest.
 class JniTestWithNoDefaultJvmRef : public ::testing::Test {
@@ -99,6 +126,14 @@ class JniTestWithNoDefaultJvmRef : public ::testing::Test {
     ON_CALL(*env_, GetFieldID).WillByDefault(Return(Fake<jfieldID>()));
     ON_CALL(*env_, NewObjectArray).WillByDefault(Return(Fake<jobjectArray>()));
     ON_CALL(*env_, NewObjectV).WillByDefault(Return(Fake<jobject>()));
+    ON_CALL(*env_, NewWeakGlobalRef).WillByDefault(testing::Invoke(AsWeak));
+    ON_CALL(*env_, IsSameObject)
+        .WillByDefault(testing::Invoke([](jobject lhs, jobject rhs) {
+          return FakeReferent(lhs) == FakeReferent(rhs);
+        }));
+    // Fakes carry no class, so objects match the first class checked (e.g. the
+    // first loaded through a class loader).
+    ON_CALL(*env_, IsInstanceOf).WillByDefault(Return(JNI_TRUE));
 
     ON_CALL(*env_, NewGlobalRef)
         .WillByDefault(testing::Invoke([&](jobject object) {
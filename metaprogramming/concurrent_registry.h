@@ -0,0 +1,128 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_METAPROGRAMMING_CONCURRENT_REGISTRY_H_
+#define JNI_BIND_METAPROGRAMMING_CONCURRENT_REGISTRY_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace jni::metaprogramming {
+
+// Append-only table of pointers that supports concurrent registration without
+// a lock.  Each registered value is given a dense slot (a single fetch_add) in
+// a chain of fixed size chunks, so sweeps are linear over contiguous memory.
+//
+// |Register| is thread-safe.  |ForEach| and |Clear| are not thread-safe
+// relative to |Register| and must be called from a single threaded context
+// (e.g. JvmRef teardown).  Chunks are retained after |Clear| for reuse.
+template <typename T, std::size_t kChunkSize = 256>
+class ConcurrentRegistry {
+  static_assert(std::is_pointer_v<T>, "Registry values must be pointers.");
+
+ public:
+  ConcurrentRegistry() = default;
+  ConcurrentRegistry(const ConcurrentRegistry&) = delete;
+  ConcurrentRegistry(ConcurrentRegistry&&) = delete;
+
+  ~ConcurrentRegistry() {
+    Chunk* chunk = head_.next_.load();
+    while (chunk != nullptr) {
+      Chunk* next = chunk->next_.load();
+      delete chunk;
+      chunk = next;
+    }
+  }
+
+  void Register(T value) {
+    const std::size_t idx = size_.fetch_add(1, std::memory_order_relaxed);
+    ChunkForIdx(idx)->values_[idx % kChunkSize].store(
+        value, std::memory_order_release);
+  }
+
+  std::size_t Size() const { return size_.load(std::memory_order_acquire); }
+
+  // Invokes |func| on every registered value in registration order.
+  template <typename Func>
+  void ForEach(Func&& func) {
+    const std::size_t size = Size();
+    const Chunk* chunk = &head_;
+
+    for (std::size_t i = 0; i < size; ++i) {
+      if (i != 0 && i % kChunkSize == 0) {
+        chunk = chunk->next_.load(std::memory_order_acquire);
+      }
+
+      if (T value = chunk->values_[i % kChunkSize].load(
+              std::memory_order_acquire)) {
+        func(value);
+      }
+    }
+  }
+
+  void Clear() {
+    const std::size_t size = Size();
+    Chunk* chunk = &head_;
+
+    for (std::size_t i = 0; i < size; ++i) {
+      if (i != 0 && i % kChunkSize == 0) {
+        chunk = chunk->next_.load(std::memory_order_acquire);
+      }
+      chunk->values_[i % kChunkSize].store(nullptr, std::memory_order_relaxed);
+    }
+
+    size_.store(0, std::memory_order_release);
+  }
+
+ private:
+  struct Chunk {
+    std::array<std::atomic<T>, kChunkSize> values_{};
+    std::atomic<Chunk*> next_{nullptr};
+  };
+
+  // Walks (and if needed, grows) the chain to the chunk holding |idx|.
+  Chunk* ChunkForIdx(std::size_t idx) {
+    Chunk* chunk = &head_;
+
+    for (std::size_t hops = idx / kChunkSize; hops > 0; --hops) {
+      Chunk* next = chunk->next_.load(std::memory_order_acquire);
+
+      if (next == nullptr) {
+        Chunk* fresh = new Chunk{};
+        if (chunk->next_.compare_exchange_strong(next, fresh,
+                                                 std::memory_order_acq_rel)) {
+          next = fresh;
+        } else {
+          // Another thread grew the chain first, |next| now holds its chunk.
+          delete fresh;
+        }
+      }
+
+      chunk = next;
+    }
+
+    return chunk;
+  }
+
+  Chunk head_;
+  std::atomic<std::size_t> size_{0};
+};
+
+}  // namespace jni::metaprogramming
+
+#endif  // JNI_BIND_METAPROGRAMMING_CONCURRENT_REGISTRY_H_
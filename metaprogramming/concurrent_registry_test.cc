@@ -0,0 +1,105 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "concurrent_registry.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace {
+
+using ::jni::metaprogramming::ConcurrentRegistry;
+using ::testing::ElementsAre;
+using ::testing::UnorderedElementsAreArray;
+
+TEST(ConcurrentRegistry, IsEmptyByDefault) {
+  ConcurrentRegistry<int*> registry;
+  EXPECT_EQ(registry.Size(), 0);
+  registry.ForEach([](int*) { FAIL(); });
+}
+
+TEST(ConcurrentRegistry, VisitsValuesInRegistrationOrder) {
+  int a, b, c;
+  ConcurrentRegistry<int*> registry;
+  registry.Register(&a);
+  registry.Register(&b);
+  registry.Register(&c);
+
+  std::vector<int*> visited;
+  registry.ForEach([&](int* val) { visited.push_back(val); });
+  EXPECT_THAT(visited, ElementsAre(&a, &b, &c));
+}
+
+TEST(ConcurrentRegistry, GrowsAcrossChunks) {
+  std::vector<int> values(10);
+  ConcurrentRegistry<int*, 3> registry;
+  for (int& val : values) {
+    registry.Register(&val);
+  }
+
+  int i = 0;
+  registry.ForEach([&](int* val) { EXPECT_EQ(val, &values[i++]); });
+  EXPECT_EQ(i, 10);
+}
+
+TEST(ConcurrentRegistry, ClearsAndReusesSlots) {
+  int a, b;
+  ConcurrentRegistry<int*, 1> registry;
+  registry.Register(&a);
+  registry.Register(&b);
+  registry.Clear();
+  EXPECT_EQ(registry.Size(), 0);
+  registry.ForEach([](int*) { FAIL(); });
+
+  registry.Register(&b);
+  std::vector<int*> visited;
+  registry.ForEach([&](int* val) { visited.push_back(val); });
+  EXPECT_THAT(visited, ElementsAre(&b));
+}
+
+TEST(ConcurrentRegistry, SupportsConcurrentRegistration) {
+  static constexpr int kNumThreads = 8;
+  static constexpr int kNumPerThread = 100;
+
+  std::vector<int> values(kNumThreads * kNumPerThread);
+  ConcurrentRegistry<int*, 16> registry;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (int i = 0; i < kNumPerThread; ++i) {
+        registry.Register(&values[t * kNumPerThread + i]);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  std::vector<int*> expected;
+  for (int& val : values) {
+    expected.push_back(&val);
+  }
+
+  std::vector<int*> visited;
+  registry.ForEach([&](int* val) { visited.push_back(val); });
+  EXPECT_THAT(visited, UnorderedElementsAreArray(expected));
+}
+
+}  // namespace
@@ -17,9 +17,8 @@
 #ifndef JNI_BIND_METAPROGRAMMING_DOUBLE_LOCKED_VALUE_H_
 #define JNI_BIND_METAPROGRAMMING_DOUBLE_LOCKED_VALUE_H_
 
-#include <mutex>
 #include <atomic>
-#include <functional>
+#include <thread>
 
 namespace jni::metaprogramming {
 
@@ -28,8 +27,13 @@ namespace jni::metaprogramming {
 // subsequent loads will be thread safe, invoking the lambda once (and only
 // once) if the currently stored value is T{0}.
 //
-// This class is thread-safe.  Loads will be cheap (after a potentially
-// expensive initial init), stores are expensive.
+// This class is thread-safe.  Loads will be cheap (a single acquire load after
+// a potentially expensive initial init), stores are expensive.
+//
+// There is one of these for every cached jclass, jmethodID and jfieldID, so
+// rather than a mutex, initialisation and teardown are guarded by a single
+// atomic flag.  The (rare) threads that race on first touch yield until the
+// winning thread publishes its value.
 template<typename T_>
 class DoubleLockedValue {
  public:
@@ -42,8 +46,8 @@ class DoubleLockedValue {
       return return_value;
     }
 
-    // Value was nil (uninitialised), perform heavy-weight lock.
-    std::lock_guard<std::mutex> lock_guard {lock_};
+    // Value was nil (uninitialised), acquire exclusive access.
+    LockGuard lock_guard{busy_};
 
     // Check another thread didn't race to lock before.
     return_value = value_.load(std::memory_order_acquire);
@@ -59,7 +63,7 @@ class DoubleLockedValue {
 
   // Sets the value to {0}.
   inline void Reset() {
-    std::lock_guard<std::mutex> lock_guard {lock_};
+    LockGuard lock_guard{busy_};
     value_.store(0, std::memory_order_release);
   }
 
@@ -67,7 +71,7 @@ class DoubleLockedValue {
   // down, the teardown lambda will be invoked with this value.
   template <typename TeardownLambda>
   inline void Reset(TeardownLambda lambda) {
-    std::lock_guard<std::mutex> lock_guard {lock_};
+    LockGuard lock_guard{busy_};
     auto val = value_.load();
     if(val != 0) {
       lambda(val);
@@ -76,8 +80,29 @@ class DoubleLockedValue {
   }
 
  private:
+  // Releases the flag even if the init or teardown lambda throws.
+  class LockGuard {
+   public:
+    explicit LockGuard(std::atomic<bool>& busy) : busy_(busy) {
+      while (busy_.exchange(true, std::memory_order_acquire)) {
+        // Initialisation may call back into the JVM, so don't burn the core.
+        while (busy_.load(std::memory_order_relaxed)) {
+          std::this_thread::yield();
+        }
+      }
+    }
+
+    LockGuard(const LockGuard&) = delete;
+    LockGuard& operator=(const LockGuard&) = delete;
+
+    ~LockGuard() { busy_.store(false, std::memory_order_release); }
+
+   private:
+    std::atomic<bool>& busy_;
+  };
+
   std::atomic<T_> value_ = {0};
-  std::mutex lock_;
+  std::atomic<bool> busy_ = {false};
 };
 
 }  // namespace jni::metaprogramming
@@ -19,7 +19,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <stdexcept>
 #include <thread>
+#include <vector>
 
 namespace {
 
@@ -103,4 +106,62 @@ TEST(DoubleLockedValue, MixesResetWithAndWithoutLambda){
   });
 }
 
+TEST(DoubleLockedValue, IsNoLargerThanTwoValues) {
+  static_assert(sizeof(DoubleLockedValue<void*>) <= 2 * sizeof(void*));
+  static_assert(sizeof(DoubleLockedValue<int>) <= 2 * sizeof(int));
+}
+
+TEST(DoubleLockedValue, InitialisesOnceUnderContention) {
+  static constexpr int kNumThreads = 16;
+  std::atomic<int> num_inits = 0;
+  std::atomic<bool> go = false;
+  DoubleLockedValue<int> double_locked_value;
+
+  std::vector<std::thread> threads;
+  std::vector<int> results(kNumThreads);
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i]() {
+      while (!go.load()) {
+      }
+      results[i] = double_locked_value.LoadAndMaybeInit([&]() {
+        std::this_thread::yield();
+        return ++num_inits + 122;
+      });
+    });
+  }
+
+  go.store(true);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(num_inits.load(), 1);
+  for (int result : results) {
+    EXPECT_EQ(result, 123);
+  }
+}
+
+TEST(DoubleLockedValue, RetriesInitialisationIfLambdaReturnsZero) {
+  int a = 0;
+  auto lambda {[&]() {return a++;}};
+  DoubleLockedValue<int> double_locked_value;
+  EXPECT_EQ(0, double_locked_value.LoadAndMaybeInit(lambda));
+  EXPECT_EQ(1, double_locked_value.LoadAndMaybeInit(lambda));
+  EXPECT_EQ(1, double_locked_value.LoadAndMaybeInit(lambda));
+}
+
+TEST(DoubleLockedValue, ReleasesTheLockIfALambdaThrows) {
+  DoubleLockedValue<int> double_locked_value;
+  EXPECT_THROW(double_locked_value.LoadAndMaybeInit(
+                   []() -> int { throw std::runtime_error{"init"}; }),
+               std::runtime_error);
+  EXPECT_EQ(123, double_locked_value.LoadAndMaybeInit([]() { return 123; }));
+
+  EXPECT_THROW(double_locked_value.Reset(
+                   [](int) { throw std::runtime_error{"teardown"}; }),
+               std::runtime_error);
+  double_locked_value.Reset();
+  EXPECT_EQ(456, double_locked_value.LoadAndMaybeInit([]() { return 456; }));
+}
+
 }  // namespace